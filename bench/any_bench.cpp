@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Microbenchmarks for the library's hot paths: virtual dispatch through
+// _value_proxy_root::_value_, in-situ vs heap emplacement, copy, swap and
+// any_cast, each measured against the obvious baselines (a raw virtual call,
+// std::function, std::any) so storage and dispatch changes can be justified
+// with numbers.
+
+#include "any/any.hpp"
+
+#include <any>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// The erased interface under test:
+template <class Base>
+struct icounter : any::interface<icounter, Base, any::extends<any::icopyable>>
+{
+  using icounter::interface::interface;
+
+  constexpr virtual int next()
+  {
+    return any::value(*this).next();
+  }
+};
+
+struct small_counter
+{
+  int next()
+  {
+    return ++count;
+  }
+
+  int count = 0;
+};
+
+struct big_counter
+{
+  int next()
+  {
+    return ++count;
+  }
+
+  int count = 0;
+  char padding[2 * sizeof(any::any<icounter>)]{};
+};
+
+// Baseline: a plain virtual call through a base-class pointer.
+struct counter_base
+{
+  virtual ~counter_base()  = default;
+  virtual int next()       = 0;
+};
+
+struct virtual_counter final : counter_base
+{
+  int next() override
+  {
+    return ++count;
+  }
+
+  int count = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// dispatch
+void bm_dispatch_raw_virtual(benchmark::State &state)
+{
+  virtual_counter impl;
+  counter_base *counter = &impl;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(counter->next());
+}
+BENCHMARK(bm_dispatch_raw_virtual);
+
+void bm_dispatch_std_function(benchmark::State &state)
+{
+  small_counter impl;
+  std::function<int()> fn = [&impl] { return impl.next(); };
+  for (auto _ : state)
+    benchmark::DoNotOptimize(fn());
+}
+BENCHMARK(bm_dispatch_std_function);
+
+template <class Counter>
+void bm_dispatch_any(benchmark::State &state)
+{
+  any::any<icounter> counter = Counter{};
+  for (auto _ : state)
+    benchmark::DoNotOptimize(counter.next());
+}
+BENCHMARK_TEMPLATE(bm_dispatch_any, small_counter); // in-situ: launder + tag branch + virtual
+BENCHMARK_TEMPLATE(bm_dispatch_any, big_counter);   // heap: launder + tag branch + virtual
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// emplace
+template <class Counter>
+void bm_emplace_any(benchmark::State &state)
+{
+  any::any<icounter> counter = Counter{};
+  for (auto _ : state)
+  {
+    counter.template emplace<Counter>(Counter{});
+    benchmark::DoNotOptimize(counter);
+  }
+}
+BENCHMARK_TEMPLATE(bm_emplace_any, small_counter); // in-situ construct_at
+BENCHMARK_TEMPLATE(bm_emplace_any, big_counter);   // heap round trip
+
+void bm_emplace_std_any(benchmark::State &state)
+{
+  std::any counter = big_counter{};
+  for (auto _ : state)
+  {
+    counter.emplace<big_counter>(big_counter{});
+    benchmark::DoNotOptimize(counter);
+  }
+}
+BENCHMARK(bm_emplace_std_any);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// copy
+template <class Counter>
+void bm_copy_any(benchmark::State &state)
+{
+  any::any<icounter> counter = Counter{};
+  for (auto _ : state)
+  {
+    any::any<icounter> copy = counter;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK_TEMPLATE(bm_copy_any, small_counter);
+BENCHMARK_TEMPLATE(bm_copy_any, big_counter);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// swap: tagged/tagged is a pointer swap; mixed in-situ falls back to the
+// three-way _move_to dance.
+template <class Lhs, class Rhs>
+void bm_swap_any(benchmark::State &state)
+{
+  any::any<icounter> lhs = Lhs{};
+  any::any<icounter> rhs = Rhs{};
+  for (auto _ : state)
+  {
+    swap(lhs, rhs);
+    benchmark::DoNotOptimize(lhs);
+  }
+}
+BENCHMARK_TEMPLATE(bm_swap_any, small_counter, small_counter);
+BENCHMARK_TEMPLATE(bm_swap_any, big_counter, big_counter);
+BENCHMARK_TEMPLATE(bm_swap_any, small_counter, big_counter);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// any_cast
+void bm_any_cast(benchmark::State &state)
+{
+  any::any<icounter> counter = small_counter{};
+  for (auto _ : state)
+    benchmark::DoNotOptimize(any::any_cast<small_counter>(&counter));
+}
+BENCHMARK(bm_any_cast);
+
+void bm_any_static_cast(benchmark::State &state)
+{
+  any::any<icounter> counter = small_counter{};
+  for (auto _ : state)
+    benchmark::DoNotOptimize(any::any_static_cast<small_counter>(&counter));
+}
+BENCHMARK(bm_any_static_cast);
+
+void bm_std_any_cast(benchmark::State &state)
+{
+  std::any counter = small_counter{};
+  for (auto _ : state)
+    benchmark::DoNotOptimize(std::any_cast<small_counter>(&counter));
+}
+BENCHMARK(bm_std_any_cast);
+} // namespace
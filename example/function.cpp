@@ -14,37 +14,10 @@
  * limitations under the License.
  */
 
-#include "any/any.hpp"
+#include "any/function.hpp"
 
-#include <cassert>
 #include <cstdio>
 
-#if ANY_COMPILER_CLANG
-#  pragma clang diagnostic ignored "-Winfinite-recursion"
-#endif
-
-template <class Signature>
-struct _ifunction;
-
-template <class Return, class... Args>
-struct _ifunction<Return(Args...)>
-{
-  // "abstract" interface for callable types
-  template <class Base>
-  struct _interface : any::interface<_interface, Base, any::extends<any::icopyable>>
-  {
-    using _interface::interface::interface;
-
-    constexpr virtual Return operator()(Args... args) const
-    {
-      return any::value(*this)(std::forward<Args>(args)...);
-    }
-  };
-};
-
-template <class Signature>
-using function = any::any<_ifunction<Signature>::template _interface>;
-
 // A concrete type that models the interface:
 struct myfun
 {
@@ -56,6 +29,11 @@ struct myfun
 
 int main()
 {
-  function<void()> fun = myfun{};
+  // any::function erases the callable like std::function, but calls go through a
+  // cached function pointer rather than the virtual interface.
+  any::function<void()> fun = myfun{};
+  fun();
+
+  fun = [] { std::printf("lambda called\n"); };
   fun();
 }
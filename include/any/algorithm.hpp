@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! for_each: batched visitation over a span of any<Interface>.
+//!
+//! Elements are bucketed by concrete type before dispatch (cheap: type identity is a
+//! pointer comparison), so within each bucket every indirect call has the same target
+//! and the branch predictor resolves it once per distinct type instead of once per
+//! element. Empty elements are skipped. @p fn is invoked with an
+//! @c iabstract<Interface>& (const when the span is const); visitation order within a
+//! bucket follows the span, but bucket order is unspecified.
+
+template <template <class> class Interface, class Fn>
+void for_each(std::span<any<Interface>> elements, Fn &&fn)
+{
+  std::vector<any<Interface> *> buckets;
+  buckets.reserve(elements.size());
+  for (auto &element : elements)
+  {
+    if (!empty(element))
+      buckets.push_back(std::addressof(element));
+  }
+
+  // type_info objects have a unique address per type, so sorting by that address
+  // groups the elements by concrete type.
+  std::stable_sort(buckets.begin(), buckets.end(), [](auto *lhs, auto *rhs) {
+    return std::addressof(type(*lhs)) < std::addressof(type(*rhs));
+  });
+
+  for (auto *element : buckets)
+    fn(value(*element));
+}
+
+//! As above, invoking @p fn with a const interface reference.
+template <template <class> class Interface, class Fn>
+void for_each(std::span<any<Interface> const> elements, Fn &&fn)
+{
+  std::vector<any<Interface> const *> buckets;
+  buckets.reserve(elements.size());
+  for (auto &element : elements)
+  {
+    if (!empty(element))
+      buckets.push_back(std::addressof(element));
+  }
+
+  std::stable_sort(buckets.begin(), buckets.end(), [](auto *lhs, auto *rhs) {
+    return std::addressof(type(*lhs)) < std::addressof(type(*rhs));
+  });
+
+  for (auto *element : buckets)
+    fn(value(*element));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! parallel_for_each: all-cores batched visitation.
+//!
+//! Elements are bucketed by concrete type exactly as in for_each, the buckets are cut
+//! into chunks that never span a type boundary, and a pool of threads (the caller
+//! included) claims chunks from a shared counter. Claiming keeps each worker's inner
+//! loop on a single virtual target, and idle workers take over the remaining chunks
+//! instead of waiting on a fixed pre-split. The any_vector overloads traverse its
+//! per-type segments the same way, with no bucketing pass at all.
+//!
+//! @p fn must be safe to invoke concurrently on distinct elements; it is never
+//! invoked concurrently on the same element. @p threads of 0 means one per hardware
+//! thread. An exception escaping @p fn on a worker thread terminates the program.
+
+//! A claimable unit of work: a half-open index range within one type's elements.
+struct _chunk
+{
+  size_t first;
+  size_t last;
+};
+
+//! Chunks small enough to balance 32 workers, big enough to amortize the claim.
+inline constexpr size_t _chunk_size = 512;
+
+[[nodiscard]]
+inline unsigned _parallel_width_(size_t chunk_count, unsigned threads) noexcept
+{
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  return static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(chunk_count, 1)));
+}
+
+//! Run @p work on @p threads threads, the caller being one of them.
+template <class Work>
+void _parallel_run_(unsigned threads, Work work)
+{
+  if (threads <= 1)
+    return work();
+
+  {
+    std::vector<std::jthread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned i = 1; i != threads; ++i)
+      pool.emplace_back(work);
+    work();
+  } // the pool joins here
+}
+
+template <class AnyCvPtr, class Fn>
+void _parallel_for_each_(std::vector<AnyCvPtr> const &buckets, Fn &fn, unsigned threads)
+{
+  std::vector<_chunk> chunks;
+  for (size_t begin = 0; begin != buckets.size();)
+  {
+    size_t end = begin + 1;
+    while (end != buckets.size()
+           && std::addressof(type(*buckets[end])) == std::addressof(type(*buckets[begin])))
+      ++end;
+
+    for (size_t first = begin; first < end; first += _chunk_size)
+      chunks.push_back({first, std::min(first + _chunk_size, end)});
+    begin = end;
+  }
+
+  std::atomic<size_t> next{0};
+  _parallel_run_(_parallel_width_(chunks.size(), threads), [&] {
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < chunks.size();)
+    {
+      for (size_t j = chunks[i].first; j != chunks[i].last; ++j)
+        fn(value(*buckets[j]));
+    }
+  });
+}
+
+template <template <class> class Interface, class Fn>
+void parallel_for_each(std::span<any<Interface>> elements, Fn fn, unsigned threads = 0)
+{
+  std::vector<any<Interface> *> buckets;
+  buckets.reserve(elements.size());
+  for (auto &element : elements)
+  {
+    if (!empty(element))
+      buckets.push_back(std::addressof(element));
+  }
+
+  std::stable_sort(buckets.begin(), buckets.end(), [](auto *lhs, auto *rhs) {
+    return std::addressof(type(*lhs)) < std::addressof(type(*rhs));
+  });
+
+  _parallel_for_each_(buckets, fn, threads);
+}
+
+//! As above, invoking @p fn with a const interface reference.
+template <template <class> class Interface, class Fn>
+void parallel_for_each(std::span<any<Interface> const> elements, Fn fn, unsigned threads = 0)
+{
+  std::vector<any<Interface> const *> buckets;
+  buckets.reserve(elements.size());
+  for (auto &element : elements)
+  {
+    if (!empty(element))
+      buckets.push_back(std::addressof(element));
+  }
+
+  std::stable_sort(buckets.begin(), buckets.end(), [](auto *lhs, auto *rhs) {
+    return std::addressof(type(*lhs)) < std::addressof(type(*rhs));
+  });
+
+  _parallel_for_each_(buckets, fn, threads);
+}
+
+template <template <class> class Interface, bool IsConst, class Fn>
+void _parallel_segments_(std::vector<_segment_view> const &views, Fn &fn, unsigned threads)
+{
+  struct _segment_chunk
+  {
+    std::byte *data;
+    size_t stride;
+    _chunk range;
+  };
+
+  std::vector<_segment_chunk> chunks;
+  for (auto const &view : views)
+  {
+    for (size_t first = 0; first < view.count; first += _chunk_size)
+      chunks.push_back({view.data, view.stride, {first, std::min(first + _chunk_size, view.count)}});
+  }
+
+  std::atomic<size_t> next{0};
+  _parallel_run_(_parallel_width_(chunks.size(), threads), [&] {
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < chunks.size();)
+    {
+      auto const [data, stride, range] = chunks[i];
+      for (size_t j = range.first; j != range.last; ++j)
+      {
+        auto &element = *::any::_polymorphic_downcast<iabstract<Interface> *>(
+            reinterpret_cast<_iroot *>(data + j * stride));
+        if constexpr (IsConst)
+          fn(std::as_const(element));
+        else
+          fn(element);
+      }
+    }
+  });
+}
+
+template <template <class> class Interface, class Fn>
+void parallel_for_each(any_vector<Interface> &elements, Fn fn, unsigned threads = 0)
+{
+  _parallel_segments_<Interface, false>(elements._segment_views_(), fn, threads);
+}
+
+template <template <class> class Interface, class Fn>
+void parallel_for_each(any_vector<Interface> const &elements, Fn fn, unsigned threads = 0)
+{
+  _parallel_segments_<Interface, true>(elements._segment_views_(), fn, threads);
+}
+} // namespace any
@@ -15,6 +15,7 @@
  */
 
 #include "detail/config.hpp"
+#include "detail/profile.hpp"
 #include "detail/typeinfo.hpp"
 #include "detail/utility.hpp"
 
@@ -22,9 +23,13 @@
 #include <cstdint>
 #include <cstring>
 
+#include <array>
 #include <bit>
+#include <compare>
 #include <exception>
+#include <functional>
 #include <memory>
+#include <memory_resource>
 #include <span>
 #include <type_traits>
 #include <utility>
@@ -136,6 +141,34 @@ namespace any
 constexpr size_t default_buffer_size = 3 * sizeof(void *);
 constexpr char const *_pure_virt_msg = "internal error: pure virtual %s() called\n";
 
+//////////////////////////////////////////////////////////////////////////////////////////
+//! interface_options: per-interface opt-in tuning knobs, passed as the last parameter
+//! of the @c interface<...> template and inherited (OR'd together) by extensions.
+enum class interface_options : unsigned
+{
+  none            = 0,
+  direct_dispatch = 1 << 0, //!< cache a ready-to-use iabstract* next to the buffer
+  heap_only       = 1 << 1, //!< always store value models out-of-line
+};
+
+[[nodiscard]]
+constexpr interface_options operator|(interface_options lhs, interface_options rhs) noexcept
+{
+  return interface_options(unsigned(lhs) | unsigned(rhs));
+}
+
+[[nodiscard]]
+constexpr interface_options operator&(interface_options lhs, interface_options rhs) noexcept
+{
+  return interface_options(unsigned(lhs) & unsigned(rhs));
+}
+
+[[nodiscard]]
+constexpr bool _has_option(interface_options options, interface_options option) noexcept
+{
+  return (options & option) == option;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // forward declarations
 
@@ -165,6 +198,12 @@ struct icopyable;
 template <class Base>
 struct iequality_comparable;
 
+template <class Base>
+struct ihashable;
+
+template <class Base>
+struct iordered;
+
 template <class Base>
 struct isemiregular;
 
@@ -175,11 +214,23 @@ using _bases_of = Interface<_iroot>::_bases_type;
 
 template <template <class> class Interface,
           class Base,
-          class BaseInterfaces   = extends<>,
-          size_t BufferSize      = default_buffer_size,
-          size_t BufferAlignment = alignof(std::max_align_t)>
+          class BaseInterfaces      = extends<>,
+          size_t BufferSize         = default_buffer_size,
+          size_t BufferAlignment    = alignof(std::max_align_t),
+          interface_options Options = interface_options::none>
 struct interface;
 
+#if ANY_PROFILE
+//! One counter block per interface, named after its any<Interface> instantiation and
+//! lazily registered with the report list on first use.
+template <template <class> class Interface>
+_profile_counters &_profile_of() noexcept
+{
+  static _profile_counters counters{_detail::_pretty_name<any<Interface>>};
+  return counters;
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // interface_cast
 template <template <class> class Interface, class Base>
@@ -291,15 +342,58 @@ template <class Interface, template <class> class BaseInterface>
 concept extension_of =
     requires(Interface const &iface) { ::any::interface_cast<BaseInterface>(iface); };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// enable_trivially_relocatable: true if a Value can be moved to a new address with
+// memcpy and the source then abandoned without running its destructor. Trivially
+// copyable types qualify automatically; types whose moves are semantically trivial
+// but not detectably so (e.g., most containers) can opt in by specializing this
+// variable template.
+template <class Value>
+inline constexpr bool enable_trivially_relocatable = std::is_trivially_copyable_v<Value>;
+
+enum class _box_kind
+{
+  _abstract,
+  _object,
+  _proxy
+};
+
+enum class _root_kind
+{
+  _value,
+  _reference
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // _is_small: Model is Interface<T> for some concrete T
 template <class Model>
 [[nodiscard]]
 constexpr bool _is_small(size_t buffer_size) noexcept
 {
-  constexpr bool nothrow_movable =
-      !extension_of<Model, imovable> || std::is_nothrow_move_constructible_v<Model>;
-  return sizeof(Model) <= buffer_size && nothrow_movable;
+  // A heap_only interface stores every value model out-of-line so that moves and
+  // derived-to-base conversions degenerate to a pointer exchange. (Reference models
+  // are just a pointer and are unaffected.)
+  if constexpr (Model::_box_kind == _box_kind::_object
+                && Model::_root_kind == _root_kind::_value
+                && _has_option(Model::_options, interface_options::heap_only))
+  {
+    return false;
+  }
+  // A reference model is a vtable and one pointer and is pinned in its proxy's
+  // buffer by design (_reference_root deletes its move constructor). The deleted
+  // move must not force it to the heap, where _reference_proxy_root would neither
+  // recognize it as indirect nor ever free it.
+  else if constexpr (Model::_box_kind == _box_kind::_object
+                     && Model::_root_kind == _root_kind::_reference)
+  {
+    return sizeof(Model) <= buffer_size;
+  }
+  else
+  {
+    constexpr bool nothrow_movable =
+        !extension_of<Model, imovable> || std::is_nothrow_move_constructible_v<Model>;
+    return sizeof(Model) <= buffer_size && nothrow_movable;
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -357,19 +451,6 @@ private:
 template <template <class> class Interface, class BaseInterfaces = _bases_of<Interface>>
 using iabstract = Interface<_mcall<BaseInterfaces, _iroot>>;
 
-enum class _box_kind
-{
-  _abstract,
-  _object,
-  _proxy
-};
-
-enum class _root_kind
-{
-  _value,
-  _reference
-};
-
 //////////////////////////////////////////////////////////////////////////////////////////
 // _iroot
 struct _iroot
@@ -377,13 +458,14 @@ struct _iroot
   static constexpr ::any::_box_kind _box_kind = ::any::_box_kind::_abstract;
   static constexpr size_t _buffer_size        = sizeof(_tagged_ptr);  // minimum size
   static constexpr size_t _buffer_alignment   = alignof(_tagged_ptr); // minimum alignment
+  static constexpr interface_options _options = interface_options::none;
   using _bases_type                           = extends<>;
 
   // needed by MSVC for EBO to work for some reason:
   constexpr virtual ~_iroot() = default;
 
 private:
-  template <template <class> class, class, class, size_t, size_t>
+  template <template <class> class, class, class, size_t, size_t, interface_options>
   friend struct interface;
   friend struct _access;
 
@@ -430,6 +512,13 @@ struct _box
   {
   }
 
+  template <class... Args>
+    requires std::is_constructible_v<Value, Args...>
+  constexpr explicit _box(Args &&...args) noexcept(std::is_nothrow_constructible_v<Value, Args...>)
+    : value_(std::forward<Args>(args)...)
+  {
+  }
+
   template <class Self>
   [[nodiscard]]
   constexpr auto &&_value_(this Self &&self) noexcept
@@ -451,6 +540,13 @@ struct [[ANY_EMPTY_BASES]] _box<Value> : private Value
   {
   }
 
+  template <class... Args>
+    requires std::is_constructible_v<Value, Args...>
+  constexpr explicit _box(Args &&...args) noexcept(std::is_nothrow_constructible_v<Value, Args...>)
+    : Value(std::forward<Args>(args)...)
+  {
+  }
+
   template <class Self>
   [[nodiscard]]
   constexpr auto &&_value_(this Self &&self) noexcept
@@ -503,11 +599,63 @@ struct extends<BaseInterface, BaseInterfaces...>
       _if_t<_already_implements<Base, BaseInterface>, BasesOfBase, BaseInterface<BasesOfBase>>>;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// _alloc_header: bookkeeping placed immediately before every heap-spilled model.
+// Recording the memory resource in the block itself lets pointer-stealing moves and
+// swaps transfer ownership freely; whichever root finally resets the block knows how
+// to return it.
+struct _alloc_header
+{
+  std::pmr::memory_resource *resource_; //!< nullptr means the global operator new
+  size_t capacity_;                     //!< bytes usable for the model
+  size_t align_;                        //!< alignment of the whole allocation
+};
+
+[[nodiscard]]
+constexpr size_t _align_up(size_t size, size_t align) noexcept
+{
+  return (size + align - 1) & ~(align - 1);
+}
+
+[[nodiscard]]
+inline _alloc_header *_header_of(void *model_ptr) noexcept
+{
+  return reinterpret_cast<_alloc_header *>(static_cast<std::byte *>(model_ptr)
+                                           - sizeof(_alloc_header));
+}
+
+//! Allocate a block with room for an @c _alloc_header followed by a model of the given
+//! size and alignment, and return the address at which to construct the model.
+[[nodiscard]]
+inline void *_heap_allocate(std::pmr::memory_resource *resource, size_t size, size_t align)
+{
+  align               = align > alignof(_alloc_header) ? align : alignof(_alloc_header);
+  size_t const offset = ::any::_align_up(sizeof(_alloc_header), align);
+  void *const block   = resource != nullptr
+                        ? resource->allocate(offset + size, align)
+                        : ::operator new(offset + size, std::align_val_t(align));
+  void *const model   = static_cast<std::byte *>(block) + offset;
+  ::new (static_cast<void *>(::any::_header_of(model))) _alloc_header{resource, size, align};
+  return model;
+}
+
+inline void _heap_deallocate(void *model_ptr) noexcept
+{
+  auto const header   = *::any::_header_of(model_ptr);
+  size_t const offset = ::any::_align_up(sizeof(_alloc_header), header.align_);
+  void *const block   = static_cast<std::byte *>(model_ptr) - offset;
+  if (header.resource_ != nullptr)
+    header.resource_->deallocate(block, offset + header.capacity_, header.align_);
+  else
+    ::operator delete(block, std::align_val_t(header.align_));
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // _emplace_into
 template <class Model, class... Args>
 constexpr Model &_emplace_into([[maybe_unused]] _iroot *&root_ptr,
                                [[maybe_unused]] std::span<std::byte> buffer,
+                               [[maybe_unused]] std::pmr::memory_resource *resource,
                                Args &&...args)
 {
   static_assert(_decayed<Model>);
@@ -525,7 +673,21 @@ constexpr Model &_emplace_into([[maybe_unused]] _iroot *&root_ptr,
     }
     else
     {
-      auto *const model = ::new Model(std::forward<Args>(args)...);
+      void *const where = ::any::_heap_allocate(resource, sizeof(Model), alignof(Model));
+#if __cpp_exceptions
+      Model *model;
+      try
+      {
+        model = ::new (where) Model(std::forward<Args>(args)...);
+      }
+      catch (...)
+      {
+        ::any::_heap_deallocate(where);
+        throw;
+      }
+#else
+      Model *const model = ::new (where) Model(std::forward<Args>(args)...);
+#endif
       *::any::start_lifetime_as<_tagged_ptr>(buffer.data()) = _tagged_ptr(model);
       return *model;
     }
@@ -534,12 +696,18 @@ constexpr Model &_emplace_into([[maybe_unused]] _iroot *&root_ptr,
 
 template <int = 0, class CvRefValue, class Value = std::decay_t<CvRefValue>>
 [[ANY_ALWAYS_INLINE]]
-inline constexpr Value &
-_emplace_into(_iroot *&root_ptr, std::span<std::byte> buffer, CvRefValue &&value)
+inline constexpr Value &_emplace_into(_iroot *&root_ptr,
+                                      std::span<std::byte> buffer,
+                                      std::pmr::memory_resource *resource,
+                                      CvRefValue &&value)
 {
-  return ::any::_emplace_into<Value>(root_ptr, buffer, std::forward<CvRefValue>(value));
+  return ::any::_emplace_into<Value>(root_ptr, buffer, resource, std::forward<CvRefValue>(value));
 }
 
+// value
+template <template <class> class Interface, class Value>
+struct _value_model;
+
 // reference
 template <template <class> class Interface, class Value, class Extension = iabstract<Interface>>
 struct _reference_root;
@@ -551,6 +719,17 @@ struct _reference_model
   using _base_t =
       Interface<_mcall<_bases_of<Interface>, _reference_root<Interface, Value, Extension>>>;
   using _base_t::_base_t;
+
+  // This is a virtual override if Interface extends icopyable. Copying from a
+  // reference materializes an owning _value_model, copy-constructed from the
+  // referenced value exactly once, directly in the destination's storage.
+  constexpr void
+  _copy_to(_iroot *&pointer, std::span<std::byte> buffer, std::pmr::memory_resource *resource) const
+  {
+    static_assert(extension_of<iabstract<Interface>, icopyable>);
+    using model_type = _value_model<Interface, std::remove_const_t<Value>>;
+    ::any::_emplace_into<model_type>(pointer, buffer, resource, value(*this));
+  }
 };
 
 // reference proxy
@@ -582,16 +761,25 @@ struct _value_model final : Interface<_mcall<_bases_of<Interface>, _value_root<I
   {
     static_assert(extension_of<iabstract<Interface>, imovable>);
     ANY_ASSERT(::any::_is_small<_value_model>(buffer.size()));
-    ::any::_emplace_into(pointer, buffer, std::move(*this));
+    ::any::_emplace_into(pointer, buffer, nullptr, std::move(*this));
     reset(*this);
   }
 
+  // This is a virtual override if Interface extends imovable
+  [[nodiscard]]
+  constexpr size_t _relocatable_size_() const noexcept
+  {
+    static_assert(extension_of<iabstract<Interface>, imovable>);
+    return enable_trivially_relocatable<Value> ? sizeof(_value_model) : 0;
+  }
+
   // This is a virtual override if Interface extends icopyable
-  constexpr void _copy_to(_iroot *&pointer, std::span<std::byte> buffer) const
+  constexpr void
+  _copy_to(_iroot *&pointer, std::span<std::byte> buffer, std::pmr::memory_resource *resource) const
   {
     static_assert(extension_of<iabstract<Interface>, icopyable>);
     ANY_ASSERT(!empty(*this));
-    ::any::_emplace_into(pointer, buffer, *this);
+    ::any::_emplace_into(pointer, buffer, resource, *this);
   }
 };
 
@@ -614,7 +802,8 @@ template <template <class> class Interface,
           class Base,
           class BaseInterfaces,
           size_t BufferSize,
-          size_t BufferAlignment>
+          size_t BufferAlignment,
+          interface_options Options>
 struct interface : Base
 {
   static_assert(std::popcount(BufferAlignment) == 1, "BufferAlignment must be a power of two");
@@ -624,14 +813,29 @@ struct interface : Base
   using Base::_slice_to_;
   using Base::Base;
 
+  static constexpr interface_options _options = Options | Base::_options;
+
+  // A heap_only interface never stores a model in situ, so its buffer collapses to
+  // the tagged pointer and conversions between heap_only interfaces are noexcept
+  // regardless of the stored type's size.
   static constexpr size_t _buffer_size =
-      BufferSize > Base::_buffer_size ? BufferSize : Base::_buffer_size;
+      _has_option(_options, interface_options::heap_only)
+          ? sizeof(_tagged_ptr)
+          : (BufferSize > Base::_buffer_size ? BufferSize : Base::_buffer_size);
 
   static constexpr size_t _buffer_alignment =
-      BufferAlignment > Base::_buffer_alignment ? BufferAlignment : Base::_buffer_alignment;
+      _has_option(_options, interface_options::heap_only)
+          ? alignof(_tagged_ptr)
+          : (BufferAlignment > Base::_buffer_alignment ? BufferAlignment
+                                                       : Base::_buffer_alignment);
 
   static constexpr bool _nothrow_slice = ::any::_nothrow_slice<_interface_type, Base, _buffer_size>;
 
+  //! Re-erase the stored concrete value into @p out. The recursion below terminates
+  //! at the object layer, which emplaces a direct _value_model over the concrete
+  //! value — slicing never produces a proxy model wrapping another proxy, so
+  //! dispatch through the converted any is exactly one virtual hop regardless of how
+  //! many conversion boundaries the value has crossed.
   //! @pre !empty(*this)
   constexpr virtual void _slice_to_(_value_proxy_root<Interface> &out) noexcept(_nothrow_slice)
   {
@@ -643,9 +847,11 @@ struct interface : Base
     }
     else if constexpr (Base::_box_kind == _box_kind::_object)
     {
-      // Move from type-erased values, but not from type-erased references
+      // Move from type-erased values, but not from type-erased references. The
+      // reference is forwarded into emplace, which constructs the new model from it
+      // directly in out's storage — one move or copy, no intermediate temporary.
       constexpr bool is_value = (Base::_root_kind == _root_kind::_value);
-      out.emplace(ANY_DECAY_COPY(::any::_move_if<is_value>(value(*this)))); // potentially throwing
+      out.emplace(::any::_move_if<is_value>(value(*this))); // potentially throwing
     }
   }
 
@@ -717,12 +923,30 @@ struct [[ANY_EMPTY_BASES]] _value_root
   }
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// _dispatch_cache: storage for the direct_dispatch interface option. When enabled it
+// holds a ready-to-use iabstract pointer, maintained by the proxy on every mutation,
+// so _value_ is a single load with no tag branch. When disabled it is an empty base.
+template <template <class> class Interface,
+          bool Enabled =
+              _has_option(iabstract<Interface>::_options, interface_options::direct_dispatch)>
+struct _dispatch_cache
+{
+};
+
+template <template <class> class Interface>
+struct _dispatch_cache<Interface, true>
+{
+  iabstract<Interface> *cached_iface_ = nullptr;
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // _value_proxy_root
 template <template <class> class Interface>
 struct [[ANY_EMPTY_BASES]] _value_proxy_root
   : iabstract<Interface>
   , _box_root_kind<_box_kind::_proxy, _root_kind::_value>
+  , _dispatch_cache<Interface>
 {
   using interface_type = iabstract<Interface>;
   using iabstract<Interface>::_buffer_size;
@@ -731,6 +955,8 @@ struct [[ANY_EMPTY_BASES]] _value_proxy_root
 
   static constexpr bool _movable  = extension_of<iabstract<Interface>, imovable>;
   static constexpr bool _copyable = extension_of<iabstract<Interface>, icopyable>;
+  static constexpr bool _direct_dispatch =
+      _has_option(iabstract<Interface>::_options, interface_options::direct_dispatch);
 
   [[ANY_ALWAYS_INLINE]]
   inline constexpr _value_proxy_root() noexcept
@@ -749,15 +975,22 @@ struct [[ANY_EMPTY_BASES]] _value_proxy_root
     requires _movable
     : _value_proxy_root()
   {
+    ANY_PROFILE_COUNT(Interface, moves_);
     swap(other);
   }
 
+  // Copies are allocated from the same memory resource as the source block (or from
+  // the global operator new when the source is in-situ or was not resource-allocated).
   constexpr _value_proxy_root(_value_proxy_root const &other)
     requires _copyable
     : _value_proxy_root()
   {
+    ANY_PROFILE_COUNT(Interface, copies_);
     if (!empty(other))
-      value(other)._copy_to(root_ptr_, buffer_);
+    {
+      value(other)._copy_to(root_ptr_, buffer_, other._resource_());
+      _refresh_dispatch_();
+    }
   }
 
   constexpr ~_value_proxy_root()
@@ -770,6 +1003,7 @@ struct [[ANY_EMPTY_BASES]] _value_proxy_root
   {
     if (this != std::addressof(other))
     {
+      ANY_PROFILE_COUNT(Interface, moves_);
       _reset_();
       swap(other);
     }
@@ -796,37 +1030,80 @@ struct [[ANY_EMPTY_BASES]] _value_proxy_root
       if (this == std::addressof(other))
         return;
 
-      auto &this_ptr = *::any::start_lifetime_as<_tagged_ptr>(buffer_);
-      auto &that_ptr = *::any::start_lifetime_as<_tagged_ptr>(other.buffer_);
-
-      // This also covers the case where both this_ptr and that_ptr are null.
-      if (this_ptr._is_tagged() && that_ptr._is_tagged())
-        return std::swap(this_ptr, that_ptr);
-
-      if (this_ptr == nullptr)
-        return value(other)._move_to(root_ptr_, buffer_);
-
-      if (that_ptr == nullptr)
-        return value(*this)._move_to(other.root_ptr_, other.buffer_);
-
-      auto temp = std::move(*this);
-      value(other)._move_to(root_ptr_, buffer_);
-      value(temp)._move_to(other.root_ptr_, other.buffer_);
+      ANY_PROFILE_COUNT(Interface, swaps_);
+      _swap_buffers_(other);
+      _refresh_dispatch_();
+      other._refresh_dispatch_();
     }
   }
 
   template <class Value, class... Args>
   constexpr Value &emplace(Args &&...args)
   {
-    _reset_();
-    return _emplace_<Value>(std::forward<Args>(args)...);
+    return _replace_<Value>(nullptr, std::forward<Args>(args)...);
   }
 
   template <int = 0, class CvRefValue, class Value = std::decay_t<CvRefValue>>
   constexpr Value &emplace(CvRefValue &&value)
   {
-    _reset_();
-    return _emplace_<Value>(std::forward<CvRefValue>(value));
+    return _replace_<Value>(nullptr, std::forward<CvRefValue>(value));
+  }
+
+  //! As above, but heap spills are allocated from @p resource instead of the global
+  //! operator new. The resource must outlive the stored model.
+  template <class Value, class... Args>
+  constexpr Value &
+  emplace(std::allocator_arg_t, std::pmr::memory_resource *resource, Args &&...args)
+  {
+    return _replace_<Value>(resource, std::forward<Args>(args)...);
+  }
+
+  template <int = 0, class CvRefValue, class Value = std::decay_t<CvRefValue>>
+  constexpr Value &
+  emplace(std::allocator_arg_t, std::pmr::memory_resource *resource, CvRefValue &&value)
+  {
+    return _replace_<Value>(resource, std::forward<CvRefValue>(value));
+  }
+
+  //! Release excess heap capacity retained by emplace. A trivially relocatable model
+  //! in an oversized reused block is moved to a right-sized allocation (or into the
+  //! in-situ buffer if it fits); anything else is left where it is.
+  constexpr void shrink_to_fit()
+    requires _movable
+  {
+    if consteval
+    {
+      // nothing to do: there is no in-situ buffer in a constant-evaluated context
+    }
+    else
+    {
+      auto &ptr = *::any::start_lifetime_as<_tagged_ptr>(buffer_);
+      if (ptr == nullptr || !ptr._is_tagged())
+        return;
+
+      size_t const size = value(*this)._relocatable_size_();
+      if (size == 0)
+        return;
+
+      void *const old_block = ptr._get();
+      auto const header     = *::any::_header_of(old_block);
+
+      constexpr bool heap_only = _has_option(_options, interface_options::heap_only);
+      if (!heap_only && size <= _buffer_size && header.align_ <= _buffer_alignment)
+      {
+        std::memcpy(buffer_, old_block, size); // overwrites ptr; the model is now in-situ
+        ::any::_heap_deallocate(old_block);
+      }
+      else if (header.capacity_ > size)
+      {
+        void *const block = ::any::_heap_allocate(header.resource_, size, header.align_);
+        std::memcpy(block, old_block, size);
+        ::any::_heap_deallocate(old_block);
+        ptr = _tagged_ptr(block);
+      }
+
+      _refresh_dispatch_();
+    }
   }
 
   [[nodiscard]]
@@ -845,21 +1122,192 @@ struct [[ANY_EMPTY_BASES]] _value_proxy_root
 private:
   template <template <class> class>
   friend struct any;
+  template <template <class> class>
+  friend struct atomic_any; // defined in atomic.hpp
   friend struct _access;
 
   template <class Value, class... Args>
-  constexpr Value &_emplace_(Args &&...args)
+  constexpr Value &_emplace_(std::pmr::memory_resource *resource, Args &&...args)
   {
     static_assert(_decayed<Value>, "Value must be an object type.");
     using model_type = _value_model<Interface, Value>;
-    auto &model = ::any::_emplace_into<model_type>(root_ptr_, buffer_, std::forward<Args>(args)...);
+    auto &model =
+        ::any::_emplace_into<model_type>(root_ptr_, buffer_, resource, std::forward<Args>(args)...);
+#if ANY_PROFILE
+    ANY_PROFILE_MODEL_SIZE(Interface, sizeof(model_type));
+    if (::any::_is_small<model_type>(_buffer_size))
+      ANY_PROFILE_COUNT(Interface, emplace_in_situ_);
+    else
+      ANY_PROFILE_COUNT(Interface, emplace_heap_);
+#endif
+    if constexpr (_direct_dispatch)
+    {
+      if !consteval
+      {
+        this->cached_iface_ = std::addressof(model);
+      }
+    }
     return model._value_();
   }
 
   template <int = 0, class CvRefValue, class Value = std::decay_t<CvRefValue>>
-  constexpr Value &_emplace_(CvRefValue &&value)
+  constexpr Value &_emplace_(std::pmr::memory_resource *resource, CvRefValue &&value)
+  {
+    return _emplace_<Value>(resource, std::forward<CvRefValue>(value));
+  }
+
+  //! Destroy the current contents and construct a new model, reusing the existing
+  //! heap block when it came from the same memory resource and has enough capacity.
+  //! Long-lived proxies that are refilled with same-sized oversized payloads thus
+  //! skip the allocator round trip entirely. When the stored value already has the
+  //! type being assigned, nothing is destroyed at all: the argument is forwarded to
+  //! the value's own assignment operator in place.
+  template <class Value, class... Args>
+  constexpr Value &_replace_(std::pmr::memory_resource *resource, Args &&...args)
+  {
+    if !consteval
+    {
+      using model_type = _value_model<Interface, Value>;
+
+      // Same-type fast path: a single assignable argument lands directly on the
+      // stored value, keeping the model (and any heap block) intact. Skipped when
+      // the caller names a different resource than the one holding the model.
+      if constexpr (sizeof...(Args) == 1 && (std::is_assignable_v<Value &, Args &&> && ...))
+      {
+        if (::any::type(*this) == ANY_TYPEID(Value) && resource == _resource_())
+        {
+          Value &stored = *static_cast<Value *>(::any::data(*this));
+          ((stored = std::forward<Args>(args)), ...);
+          return stored;
+        }
+      }
+
+      if (!::any::_is_small<model_type>(_buffer_size))
+      {
+        if (void *const block =
+                _reuse_block_(sizeof(model_type), alignof(model_type), resource))
+          return _emplace_in_block_<Value>(block, std::forward<Args>(args)...);
+      }
+    }
+    _reset_();
+    return _emplace_<Value>(resource, std::forward<Args>(args)...);
+  }
+
+  template <int = 0, class CvRefValue, class Value = std::decay_t<CvRefValue>>
+  constexpr Value &_replace_(std::pmr::memory_resource *resource, CvRefValue &&value)
+  {
+    return _replace_<Value>(resource, std::forward<CvRefValue>(value));
+  }
+
+  //! Destroy the stored model and surrender its heap block for reuse if the block
+  //! came from @p resource and can hold a model of the given size and alignment.
+  //! Returns nullptr (leaving *this untouched) otherwise. Runtime only.
+  [[nodiscard]]
+  void *_reuse_block_(size_t size, size_t align, std::pmr::memory_resource *resource) noexcept
+  {
+    auto &ptr = *::any::start_lifetime_as<_tagged_ptr>(buffer_);
+    if (ptr == nullptr || !ptr._is_tagged())
+      return nullptr;
+
+    auto *const header = ::any::_header_of(ptr._get());
+    if (header->capacity_ < size || header->align_ < align || header->resource_ != resource)
+      return nullptr;
+
+    void *const block = ptr._get();
+    std::destroy_at(std::addressof(_value_()));
+    ptr = _tagged_ptr(); // empty until the new model is constructed
+    if constexpr (_direct_dispatch)
+      this->cached_iface_ = nullptr;
+    return block;
+  }
+
+  //! @pre *this is empty and @p block came from _reuse_block_
+  template <class Value, class... Args>
+  Value &_emplace_in_block_(void *block, Args &&...args)
+  {
+    using model_type = _value_model<Interface, Value>;
+    model_type *model;
+#if __cpp_exceptions
+    try
+    {
+      model = ::new (block) model_type(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+      ::any::_heap_deallocate(block);
+      throw;
+    }
+#else
+    model = ::new (block) model_type(std::forward<Args>(args)...);
+#endif
+    *::any::start_lifetime_as<_tagged_ptr>(buffer_) = _tagged_ptr(model);
+    if constexpr (_direct_dispatch)
+      this->cached_iface_ = model;
+    ANY_PROFILE_MODEL_SIZE(Interface, sizeof(model_type));
+    ANY_PROFILE_COUNT(Interface, emplace_heap_);
+    return model->_value_();
+  }
+
+  //! The runtime guts of swap; the dispatch cache is refreshed by the caller.
+  constexpr void _swap_buffers_(_value_proxy_root &other) noexcept
+    requires _movable
+  {
+    auto &this_ptr = *::any::start_lifetime_as<_tagged_ptr>(buffer_);
+    auto &that_ptr = *::any::start_lifetime_as<_tagged_ptr>(other.buffer_);
+
+    // This also covers the case where both this_ptr and that_ptr are null.
+    if (this_ptr._is_tagged() && that_ptr._is_tagged())
+      return std::swap(this_ptr, that_ptr);
+
+    if (this_ptr == nullptr)
+      return _relocate_from_(other);
+
+    if (that_ptr == nullptr)
+      return other._relocate_from_(*this);
+
+    // Both hold a model and at least one of them is in-situ. If every in-situ
+    // model is trivially relocatable the buffers can simply be exchanged
+    // byte-wise; a tagged pointer just travels along with the bytes.
+    bool const this_swappable = this_ptr._is_tagged() || value(*this)._relocatable_size_() != 0;
+    bool const that_swappable = that_ptr._is_tagged() || value(other)._relocatable_size_() != 0;
+
+    if (this_swappable && that_swappable)
+      return std::swap(buffer_, other.buffer_);
+
+    auto temp = std::move(*this);
+    value(other)._move_to(root_ptr_, buffer_);
+    value(temp)._move_to(other.root_ptr_, other.buffer_);
+  }
+
+  //! Move the in-situ model in @p other into *this. Trivially relocatable models
+  //! are moved with a single memcpy; everything else takes the virtual _move_to
+  //! path. Runtime only.
+  //! @pre *this is empty and other holds an in-situ model
+  constexpr void _relocate_from_(_value_proxy_root &other) noexcept
+  {
+    if (value(other)._relocatable_size_() == 0)
+      return value(other)._move_to(root_ptr_, buffer_);
+
+    std::memcpy(buffer_, other.buffer_, sizeof(buffer_));
+    *::any::start_lifetime_as<_tagged_ptr>(other.buffer_) = _tagged_ptr();
+  }
+
+  //! The memory resource that the stored model was allocated from, or nullptr if the
+  //! model is stored in-situ or came from the global operator new.
+  [[nodiscard]]
+  constexpr std::pmr::memory_resource *_resource_() const noexcept
   {
-    return _emplace_<Value>(std::forward<CvRefValue>(value));
+    if consteval
+    {
+      return nullptr;
+    }
+    else
+    {
+      auto const ptr = *::any::start_lifetime_as<_tagged_ptr>(buffer_);
+      if (ptr == nullptr || !ptr._is_tagged())
+        return nullptr;
+      return ::any::_header_of(ptr._get())->resource_;
+    }
   }
 
   template <class Self>
@@ -874,6 +1322,12 @@ private:
       return static_cast<interface_ref_t>(
           *::any::_polymorphic_downcast<interface_ptr_t>(self.root_ptr_));
     }
+    else if constexpr (_direct_dispatch)
+    {
+      // One load, no tag branch: the cached pointer is maintained on every mutation.
+      ANY_ASSERT(self.cached_iface_ != nullptr);
+      return static_cast<interface_ref_t>(*self.cached_iface_);
+    }
     else
     {
       auto const ptr = *::any::start_lifetime_as<_tagged_ptr>(self.buffer_);
@@ -909,11 +1363,18 @@ private:
       if (ptr == nullptr)
         return;
       else if (!ptr._is_tagged())
+      {
         std::destroy_at(std::addressof(_value_()));
+      }
       else
-        delete std::addressof(_value_());
+      {
+        std::destroy_at(std::addressof(_value_()));
+        ::any::_heap_deallocate(ptr._get());
+      }
 
       ptr = _tagged_ptr();
+      if constexpr (_direct_dispatch)
+        this->cached_iface_ = nullptr;
     }
   }
 
@@ -929,6 +1390,29 @@ private:
     return _empty_() ? nullptr : data(_value_());
   }
 
+  //! Recompute the cached dispatch pointer from the buffer. Must be called after
+  //! every operation that stores, moves or removes a model behind _value_'s back.
+  constexpr void _refresh_dispatch_() noexcept
+  {
+    if constexpr (_direct_dispatch)
+    {
+      if !consteval
+      {
+        auto const ptr = *::any::start_lifetime_as<_tagged_ptr>(buffer_);
+        if (ptr == nullptr)
+        {
+          this->cached_iface_ = nullptr;
+        }
+        else
+        {
+          auto *root_ptr = static_cast<_iroot *>(ptr._is_tagged() ? ptr._get()
+                                                                  : static_cast<void *>(buffer_));
+          this->cached_iface_ = ::any::_polymorphic_downcast<iabstract<Interface> *>(root_ptr);
+        }
+      }
+    }
+  }
+
   union
   {
     _iroot *root_ptr_ = nullptr;                                //!< Used in consteval context
@@ -1209,13 +1693,13 @@ struct [[ANY_EMPTY_BASES]] _reference_proxy_root
     if constexpr (CvModel::_root_kind == _root_kind::_reference)
     {
       ::any::_emplace_into<model_type>(
-          root_ptr_, buffer_, model._get_value_ptr_(), model._get_root_ptr_());
+          root_ptr_, buffer_, nullptr, model._get_value_ptr_(), model._get_root_ptr_());
     }
     else
     {
       _iroot *root = std::addressof(const_cast<std::remove_cv_t<CvModel> &>(model));
       ::any::_emplace_into<model_type>(
-          root_ptr_, buffer_, static_cast<value_type *>(nullptr), ANY_DECAY_COPY(root));
+          root_ptr_, buffer_, nullptr, static_cast<value_type *>(nullptr), ANY_DECAY_COPY(root));
     }
   }
 
@@ -1225,7 +1709,7 @@ struct [[ANY_EMPTY_BASES]] _reference_proxy_root
     static_assert(!extension_of<CvValue, Interface>);
     using model_type = _reference_model<Interface, CvValue>;
     ::any::_emplace_into<model_type>(
-        root_ptr_, buffer_, std::addressof(value), static_cast<_iroot *>(nullptr));
+        root_ptr_, buffer_, nullptr, std::addressof(value), static_cast<_iroot *>(nullptr));
   }
 
   template <class Self>
@@ -1415,11 +1899,19 @@ struct _basic_cast_t
   constexpr auto *operator()(Interface<Base> *ptr) const noexcept
   {
     if constexpr (extension_of<Value, Interface>)
+    {
       return ptr;
+    }
     else if (ptr == nullptr || empty(*ptr))
+    {
       return static_cast<Value *>(nullptr);
+    }
     else
-      return _cast(ptr);
+    {
+      auto *result = _cast(ptr);
+      _profile_cast_<Interface>(result != nullptr);
+      return result;
+    }
   }
 
   template <template <class> class Interface, class Base>
@@ -1427,11 +1919,19 @@ struct _basic_cast_t
   constexpr auto *operator()(Interface<Base> const *ptr) const noexcept
   {
     if constexpr (extension_of<Value, Interface>)
+    {
       return ptr;
+    }
     else if (ptr == nullptr || empty(*ptr))
+    {
       return static_cast<Value const *>(nullptr);
+    }
     else
-      return _cast(ptr);
+    {
+      auto *result = _cast(ptr);
+      _profile_cast_<Interface>(result != nullptr);
+      return result;
+    }
   }
 
   template <template <class> class Interface, class Base>
@@ -1485,6 +1985,21 @@ private:
   static_assert(_decayed<Value>);
   // The cast is either checked (dynamic) or unchecked (static)
   static constexpr _Cast<Value> _cast{};
+
+  // Only checked (dynamic) casts contribute to the hit-rate counters.
+  template <template <class> class Interface>
+  static constexpr void _profile_cast_([[maybe_unused]] bool hit) noexcept
+  {
+#if ANY_PROFILE
+    if constexpr (std::is_same_v<_Cast<Value>, _any_dynamic_cast_t<Value>>)
+    {
+      if (hit)
+        ANY_PROFILE_COUNT(Interface, cast_hits_);
+      else
+        ANY_PROFILE_COUNT(Interface, cast_misses_);
+    }
+#endif
+  }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1518,6 +2033,14 @@ struct imovable : interface<imovable, Base>
   {
     ::any::_die(_pure_virt_msg, "_move_to");
   }
+
+  //! The size in bytes of the stored model if it can be moved to a new buffer with
+  //! memcpy and the old bytes abandoned, or zero if it cannot.
+  [[nodiscard]]
+  constexpr virtual size_t _relocatable_size_() const noexcept
+  {
+    return 0;
+  }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1527,16 +2050,27 @@ struct icopyable : interface<icopyable, Base, extends<imovable>>
 {
   using icopyable::interface::interface;
 
-  constexpr virtual void _copy_to(_iroot *&, std::span<std::byte>) const
+  constexpr virtual void
+  _copy_to(_iroot *&pointer, std::span<std::byte> buffer, std::pmr::memory_resource *resource) const
   {
-    ::any::_die(_pure_virt_msg, "_copy_to");
+    // A reference can bind a proxy directly (see _model_bind_); copying through it
+    // recurses one virtual hop to the proxy's own model. The object layers override
+    // this in _value_model and _reference_model.
+    if constexpr (Base::_box_kind == _box_kind::_proxy)
+      value(*this)._copy_to(pointer, buffer, resource);
+    else
+      ::any::_die(_pure_virt_msg, "_copy_to");
   }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // utils
+template <class Value>
+inline constexpr bool _is_static_any = false; // true for static_any specializations
+
 template <class Value, template <class> class Interface>
-concept _model_of = _decayed<Value> && !std::derived_from<Value, _iroot>;
+concept _model_of =
+    _decayed<Value> && !std::derived_from<Value, _iroot> && !_is_static_any<Value>;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // any
@@ -1559,7 +2093,37 @@ public:
   constexpr any(Value value)
     : any()
   {
-    (*this)._emplace_(std::move(value));
+    (*this)._emplace_(nullptr, std::move(value));
+  }
+
+  // As above, but if the model does not fit in the in-situ buffer it is allocated
+  // from the given memory resource, which must outlive the stored model.
+  template <_model_of<Interface> Value>
+  constexpr any(std::allocator_arg_t, std::pmr::memory_resource *resource, Value value)
+    : any()
+  {
+    (*this)._emplace_(resource, std::move(value));
+  }
+
+  // Construct the stored object in place, directly in the buffer or heap block,
+  // so it is never moved.
+  template <_model_of<Interface> Value, class... Args>
+  constexpr any(std::in_place_type_t<Value>, Args &&...args)
+    : any()
+  {
+    (*this).template _emplace_<Value>(nullptr, std::forward<Args>(args)...);
+  }
+
+  // As above, but if the model does not fit in the in-situ buffer it is allocated
+  // from the given memory resource, which must outlive the stored model.
+  template <_model_of<Interface> Value, class... Args>
+  constexpr any(std::allocator_arg_t,
+                std::pmr::memory_resource *resource,
+                std::in_place_type_t<Value>,
+                Args &&...args)
+    : any()
+  {
+    (*this).template _emplace_<Value>(resource, std::forward<Args>(args)...);
   }
 
   // Implicit derived-to-base conversion constructor
@@ -1570,21 +2134,35 @@ public:
     (*this)._assign(std::move(other));
   }
 
+  // Materialize an owned copy of a referenced value (an any_ptr/any_ref view). When
+  // the reference's model derives from our interface, _copy_to constructs the value
+  // model directly in our buffer or heap block — the value is copy-constructed
+  // exactly once, with no temporary and no _slice_to_ re-erasure.
   template <class Other>
     requires extension_of<Interface<Other>, icopyable>
           && (Other::_root_kind == _root_kind::_reference)
   constexpr any(Interface<Other> const &other)
   {
-    Interface<Other> temp;
-    temp._copy(other);
-    (*this)._assign(std::move(temp));
+    if constexpr (std::derived_from<Other, iabstract<Interface>>)
+    {
+      if (!empty(other))
+      {
+        value(other)._copy_to((*this).root_ptr_, (*this).buffer_, nullptr);
+        (*this)._refresh_dispatch_();
+      }
+    }
+    else
+    {
+      Interface<Other> temp;
+      temp._copy(other);
+      (*this)._assign(std::move(temp));
+    }
   }
 
   template <_model_of<Interface> Value>
   constexpr any &operator=(Value value)
   {
-    reset(*this);
-    (*this)._emplace_(std::move(value));
+    (*this)._replace_(nullptr, std::move(value));
     return *this;
   }
 
@@ -1598,6 +2176,8 @@ public:
     return *this;
   }
 
+  //! As the converting constructor above: the referenced value is copy-constructed
+  //! exactly once, directly into our storage.
   template <class Other>
     requires extension_of<Interface<Other>, icopyable>
           && (Other::_root_kind == _root_kind::_reference)
@@ -1607,11 +2187,23 @@ public:
     if (data(other) == data(*this))
       return *this;
 
-    Interface<Other> temp;
-    temp._copy(other);
+    if constexpr (std::derived_from<Other, iabstract<Interface>>)
+    {
+      reset(*this);
+      if (!empty(other))
+      {
+        value(other)._copy_to((*this).root_ptr_, (*this).buffer_, nullptr);
+        (*this)._refresh_dispatch_();
+      }
+    }
+    else
+    {
+      Interface<Other> temp;
+      temp._copy(other);
 
-    reset(*this);
-    (*this)._assign(std::move(temp));
+      reset(*this);
+      (*this)._assign(std::move(temp));
+    }
     return *this;
   }
 
@@ -1621,6 +2213,28 @@ public:
     lhs.swap(rhs);
   }
 
+  //! Re-erase the stored value into this interface's canonical direct model.
+  //!
+  //! Derived-to-base conversion already guarantees one-hop dispatch (see
+  //! interface::_slice_to_), so the stored model is always a _value_model over the
+  //! concrete value; what conversion can leave behind is a model instantiated for a
+  //! derived interface, in a buffer or heap block sized for it. flatten() rebuilds
+  //! the value in the model this interface would have produced directly, releasing
+  //! any excess storage in the process. A heap spill during rebuilding is allocated
+  //! from the global operator new, not from any memory resource the previous block
+  //! came from. flatten() cannot see through a deliberately nested any stored *as*
+  //! the value; that re-erases as-is.
+  constexpr void flatten()
+    requires any::_movable
+  {
+    if (empty(*this))
+      return;
+
+    any temp;
+    (*this)._slice_to_(temp); // moves the concrete value; resets *this
+    (*this).swap(temp);
+  }
+
 private:
   // Assigning from a type that extends Interface. Its buffer may be larger than
   // ours, or it may be a reference type, so we can be only conditionally
@@ -1641,6 +2255,22 @@ private:
     }
     else if (other._in_situ_())
     {
+      // A trivially relocatable model that fits in our buffer can be memcpy'd
+      // across instead of taking the _slice_to_/emplace round trip. _in_situ_ is
+      // always false during constant evaluation, so this branch is runtime-only.
+      if constexpr (iabstract<Interface>::_buffer_alignment % Interface<Other>::_buffer_alignment
+                    == 0)
+      {
+        if (size_t const size = value(other)._relocatable_size_();
+            size != 0 && size <= iabstract<Interface>::_buffer_size)
+        {
+          std::memcpy((*this).buffer_, other.buffer_, size);
+          *::any::start_lifetime_as<_tagged_ptr>(other.buffer_) = _tagged_ptr();
+          (*this)._refresh_dispatch_();
+          other._refresh_dispatch_();
+          return;
+        }
+      }
       return other._slice_to_(*this);
     }
     else if consteval
@@ -1652,12 +2282,152 @@ private:
       auto &this_ptr = *::any::start_lifetime_as<_tagged_ptr>((*this).buffer_);
       auto &that_ptr = *::any::start_lifetime_as<_tagged_ptr>(other.buffer_);
       this_ptr       = std::exchange(that_ptr, nullptr);
+      (*this)._refresh_dispatch_();
+      other._refresh_dispatch_();
     }
   }
 
   static_assert(sizeof(iabstract<Interface>) == sizeof(void *)); // sanity check
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// make_any: construct an any<Interface> holding a Value built in place from args
+template <template <class> class Interface, class Value, class... Args>
+[[nodiscard]]
+constexpr any<Interface> make_any(Args &&...args)
+{
+  return any<Interface>(std::in_place_type<Value>, std::forward<Args>(args)...);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! static_any: an interface-erased instance that can be built at compile time.
+//!
+//! Unlike @c any<Interface>, which stores its model behind a buffer/pointer union that
+//! cannot be constant-initialized for runtime use, a @c static_any holds the
+//! @c _value_model directly as a member. A @c constinit (or @c constexpr) instance is
+//! laid down in the binary by the compiler — no startup construction, no dirtied pages
+//! beyond the vtable pointer relocation. Dereference to reach the interface.
+template <template <class> class Interface, _model_of<Interface> Value>
+struct static_any
+{
+  using interface_type = iabstract<Interface>;
+  using value_type     = Value;
+
+  constexpr static_any(Value value) noexcept(std::is_nothrow_move_constructible_v<Value>)
+    : model_(std::move(value))
+  {
+  }
+
+  template <class... Args>
+    requires std::is_constructible_v<Value, Args...>
+  constexpr explicit static_any(std::in_place_t, Args &&...args) noexcept(
+      std::is_nothrow_constructible_v<Value, Args...>)
+    : model_(std::forward<Args>(args)...)
+  {
+  }
+
+  [[ANY_ALWAYS_INLINE, nodiscard]]
+  inline constexpr auto &operator*(this auto &&self) noexcept
+  {
+    return self.model_;
+  }
+
+  [[ANY_ALWAYS_INLINE, nodiscard]]
+  inline constexpr auto *operator->(this auto &&self) noexcept
+  {
+    return std::addressof(self.model_);
+  }
+
+  //! Copy the stored value into a full-fat any<Interface>.
+  constexpr operator any<Interface>() const
+    requires std::is_copy_constructible_v<Value>
+  {
+    return any<Interface>(std::in_place_type<Value>, value(model_));
+  }
+
+private:
+  _value_model<Interface, Value> model_;
+};
+
+// A static_any is not itself a value to be erased; without this, the conversion to
+// any<Interface> would be ambiguous with any's converting constructor.
+template <template <class> class Interface, class Value>
+inline constexpr bool _is_static_any<static_any<Interface, Value>> = true;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! Storage introspection: compile-time answers to "where will this value live?"
+//!
+//! An interface's @c _buffer_size folds in every base interface (the max wins), so the
+//! buffer an @c any<Interface> actually carries is decided far from the point where any
+//! one interface picked its @c BufferSize. @c storage_report surfaces the resolved
+//! numbers together with each direct base's demand, so a ballooned container element can
+//! be traced to the base that grew it, and @c ANY_ASSERT_INLINE turns a silent spill to
+//! the heap into a compile error.
+
+//! One base interface's stake in the resolved buffer: its identity and the buffer
+//! size/alignment it demands. Each entry has already folded in its own bases; to chase a
+//! contribution further down the hierarchy, take a @c storage_report of that base.
+struct storage_contribution
+{
+  type_info const *interface;
+  size_t buffer_size;
+  size_t buffer_alignment;
+};
+
+template <class BaseInterfaces>
+struct _contributions_of;
+
+template <template <class> class... BaseInterfaces>
+struct _contributions_of<extends<BaseInterfaces...>>
+{
+  static constexpr std::array<storage_contribution, sizeof...(BaseInterfaces)> value{
+      storage_contribution{&ANY_TYPEID(iabstract<BaseInterfaces>),
+                           iabstract<BaseInterfaces>::_buffer_size,
+                           iabstract<BaseInterfaces>::_buffer_alignment}...};
+};
+
+//! Whether a @c Value stored in an @c any<Interface> lives in the inline buffer. This is
+//! exactly the test the emplace path applies: false when the value model is too big for
+//! the buffer, when the interface extends @c imovable but the value is not nothrow
+//! movable, or when the interface is @c heap_only.
+template <template <class> class Interface, class Value>
+inline constexpr bool fits_inline =
+    ::any::_is_small<_value_model<Interface, Value>>(iabstract<Interface>::_buffer_size);
+
+//! The smallest @c BufferSize at which every listed @c Value would be stored inline
+//! (assuming the values are nothrow movable where the interface requires it, and the
+//! interface is not @c heap_only, for which no buffer size helps).
+template <template <class> class Interface, class... Values>
+  requires(sizeof...(Values) != 0)
+inline constexpr size_t required_buffer_for =
+    std::max({sizeof(_value_model<Interface, Values>)...});
+
+//! The resolved storage parameters of @c any<Interface>, all compile-time constants.
+template <template <class> class Interface>
+struct storage_report
+{
+  using interface_type = iabstract<Interface>;
+
+  //! The inline buffer after folding in every base interface.
+  static constexpr size_t buffer_size        = interface_type::_buffer_size;
+  static constexpr size_t buffer_alignment   = interface_type::_buffer_alignment;
+  static constexpr interface_options options = interface_type::_options;
+
+  //! The full footprint of one @c any<Interface>: buffer, vtable pointer, padding.
+  static constexpr size_t footprint = sizeof(any<Interface>);
+  static constexpr size_t alignment = alignof(any<Interface>);
+
+  //! The direct base interfaces and the buffer each demands. The largest entries are
+  //! the ones that set @c buffer_size and @c buffer_alignment above.
+  static constexpr auto contributing_bases = _contributions_of<_bases_of<Interface>>::value;
+
+  template <class Value>
+  static constexpr bool fits_inline = ::any::fits_inline<Interface, Value>;
+
+  template <class... Values>
+  static constexpr size_t required_buffer_for = ::any::required_buffer_for<Interface, Values...>;
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // _any_ptr_base
 template <template <class> class Interface>
@@ -1936,14 +2706,169 @@ private:
   }
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+//! iordered: type-erased total ordering for values whose type defines operator<=>.
+//!
+//! Sorting a vector of any<Interface> without this meant casting both sides of every
+//! comparison through any_cast — two type checks plus a virtual call per compare.
+//! Here the type identity is checked once per comparison; same-type elements then
+//! compare through the concrete operator<=> in the model layer, and elements of
+//! different types order by type name, which groups a sorted range by concrete type.
+//! Empty anys compare equal to each other and sort together under type void.
+//!
+//! Opt-in: add iordered to your interface's extends<> list. It is deliberately not
+//! part of isemiregular, which would demand operator<=> of every stored type.
+template <class Base>
+struct iordered : interface<iordered, Base>
+{
+  using iordered::interface::interface;
+
+  template <class Other>
+  [[nodiscard]]
+  constexpr std::strong_ordering operator<=>(iordered<Other> const &other) const
+  {
+    return _compare_(::any::caddressof(other));
+  }
+
+private:
+  [[nodiscard]]
+  constexpr virtual std::strong_ordering _compare_(any_const_ptr<iordered> other) const
+  {
+    auto const &type = ::any::type(*this);
+
+    if (type != ::any::type(*other))
+      return type <=> ::any::type(*other);
+
+    if (type == ANY_TYPEID(void))
+      return std::strong_ordering::equal;
+
+    if constexpr (Base::_box_kind == _box_kind::_proxy)
+    {
+      return value(*this) <=> value(*other);
+    }
+    else if constexpr (Base::_box_kind == _box_kind::_object)
+    {
+      using value_type = value_of_t<iordered>;
+      // strong_order treats floating point as totally ordered instead of rejecting
+      // its partial_ordering; types without <=> fall back to == and <.
+      return std::compare_strong_order_fallback(value(*this),
+                                                ::any::any_static_cast<value_type>(*other));
+    }
+    else
+    {
+      return ::any::_die<std::strong_ordering>(_pure_virt_msg, "compare");
+    }
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// ihashable
+template <class Base>
+struct ihashable : interface<ihashable, Base>
+{
+  using ihashable::interface::interface;
+
+  [[nodiscard]]
+  constexpr size_t hash() const
+  {
+    return _hash_();
+  }
+
+private:
+  [[nodiscard]]
+  constexpr virtual size_t _hash_() const
+  {
+    if (::any::type(*this) == ANY_TYPEID(void))
+      return 0;
+
+    if constexpr (Base::_box_kind == _box_kind::_proxy)
+    {
+      return value(*this).hash();
+    }
+    else if constexpr (Base::_box_kind == _box_kind::_object)
+    {
+      // Mix the type identity into the value's hash so that equal representations
+      // of distinct types do not collide systematically.
+      using value_type  = value_of_t<ihashable>;
+      size_t const seed = ::any::type(*this).hash_code();
+      return seed ^ (std::hash<value_type>{}(value(*this)) + 0x9e3779b97f4a7c15u
+                     + (seed << 6) + (seed >> 2));
+    }
+    else
+    {
+      return ::any::_die<size_t>(_pure_virt_msg, "hash");
+    }
+  }
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // isemiregular
 template <class Base>
-struct isemiregular : interface<isemiregular, Base, extends<icopyable, iequality_comparable>>
+struct isemiregular
+  : interface<isemiregular, Base, extends<icopyable, iequality_comparable, ihashable>>
 {
   using isemiregular::interface::interface;
 };
 
 } // namespace any
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// std::hash support for any types whose interface extends ihashable
+template <template <class> class Interface>
+  requires any::extension_of<any::iabstract<Interface>, any::ihashable>
+struct std::hash<any::any<Interface>>
+{
+  [[nodiscard]]
+  constexpr size_t operator()(any::any<Interface> const &obj) const
+  {
+    return obj.hash();
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! ANY_EXTERN_INTERFACE / ANY_INSTANTIATE_INTERFACE
+//!
+//! Every any<Interface> pulls in five Interface instantiations plus the proxy and
+//! pointer machinery (see the table at the top of this header), and a large program
+//! re-instantiates all of it identically in every translation unit that touches the
+//! interface — padding compile times and leaving duplicate weak symbols for the
+//! linker to deduplicate. Put ANY_EXTERN_INTERFACE(imy_interface) in a header after
+//! the interface's definition and ANY_INSTANTIATE_INTERFACE(imy_interface) in
+//! exactly one .cpp file to compile the machinery once. Interfaces that extend other
+//! interfaces should apply the macro pair to each interface in the hierarchy. The
+//! argument may be namespace-qualified; the macros must be used at namespace scope
+//! in an enclosing namespace of the interface.
+//!
+//! The per-value model templates (_value_model<Interface, Value>) depend on the
+//! stored type and cannot be pre-instantiated here.
+
+#define ANY_DETAIL_INSTANTIATE_INTERFACE(_KEYWORD, _I)                                             \
+  _KEYWORD struct _I<::any::_mcall<::any::_bases_of<_I>, ::any::_iroot>>;                          \
+  _KEYWORD struct _I<::any::_mcall<::any::_bases_of<_I>, ::any::_value_proxy_root<_I>>>;           \
+  _KEYWORD struct _I<::any::_mcall<::any::_bases_of<_I>, ::any::_reference_proxy_root<_I>>>;       \
+  _KEYWORD struct ::any::_value_proxy_root<_I>;                                                    \
+  _KEYWORD struct ::any::_reference_proxy_root<_I>;                                                \
+  _KEYWORD struct ::any::_value<_I>;                                                               \
+  _KEYWORD struct ::any::_reference<_I>;                                                           \
+  _KEYWORD struct ::any::_any_ptr_base<_I>;                                                        \
+  _KEYWORD struct ::any::any<_I>;                                                                  \
+  _KEYWORD struct ::any::any_ptr<_I>;                                                              \
+  _KEYWORD struct ::any::any_const_ptr<_I>
+
+#define ANY_EXTERN_INTERFACE(_I)      ANY_DETAIL_INSTANTIATE_INTERFACE(extern template, _I)
+#define ANY_INSTANTIATE_INTERFACE(_I) ANY_DETAIL_INSTANTIATE_INTERFACE(template, _I)
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! ANY_ASSERT_INLINE
+//!
+//! Fails to compile when a @c _VALUE stored in an @c any<_INTERFACE> would spill to the
+//! heap. Drop one next to a value type that a hot container depends on keeping in situ,
+//! and CI catches the regression when someone grows the value or an interface in the
+//! hierarchy shrinks the buffer.
+
+#define ANY_ASSERT_INLINE(_INTERFACE, _VALUE)                                                      \
+  static_assert(::any::fits_inline<_INTERFACE, _VALUE>,                                            \
+                "`" #_VALUE "` no longer fits in the inline buffer of `any<" #_INTERFACE ">`; "    \
+                "see any::storage_report<" #_INTERFACE "> for the resolved storage parameters")
+
 ANY_DIAG_POP
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+#include <memory_resource>
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! any_arena: scoped storage for type-erased objects with bulk teardown.
+//!
+//! Objects built with emplace() live directly in a monotonic buffer owned by the
+//! arena. Only values with non-trivial destructors are registered for teardown, so
+//! destroying (or release()ing) the arena runs those few finalizers and then returns
+//! all of the arena's memory to the upstream resource in a handful of deallocations,
+//! instead of a virtual-destructor-plus-delete round trip per object.
+//!
+//! resource() exposes the underlying bump allocator for the allocator_arg
+//! constructors, tying the heap spills of long-lived any<> objects to the arena's
+//! lifetime. The arena must outlive every object and handle it produces.
+struct any_arena
+{
+  explicit any_arena(size_t initial_size                 = 4096,
+                     std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+    : buffer_(initial_size, upstream)
+  {
+  }
+
+  ~any_arena()
+  {
+    release();
+  }
+
+  //! Construct a @c Value in arena storage and return a type-erased pointer to it.
+  //! The object lives until the arena is destroyed or release()d.
+  template <template <class> class Interface, _model_of<Interface> Value, class... Args>
+    requires std::is_constructible_v<Value, Args...>
+  any_ptr<Interface> emplace(Args &&...args)
+  {
+    void *const mem  = buffer_.allocate(sizeof(Value), alignof(Value));
+    Value *const ptr = ::new (mem) Value(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<Value>)
+      _defer_destroy_(ptr);
+    return any_ptr<Interface>(ptr);
+  }
+
+  //! The arena's bump allocator, for use with the allocator_arg constructors.
+  [[nodiscard]]
+  std::pmr::memory_resource *resource() noexcept
+  {
+    return &buffer_;
+  }
+
+  //! Destroy the registered objects (newest first) and free all arena memory at
+  //! once. Handles and any<> objects backed by the arena must already be gone.
+  void release() noexcept
+  {
+    for (auto *f = std::exchange(finalizers_, nullptr); f != nullptr; f = f->next_)
+      f->destroy_(f->object_);
+    buffer_.release();
+  }
+
+private:
+  struct _finalizer
+  {
+    void (*destroy_)(void *) noexcept;
+    void *object_;
+    _finalizer *next_;
+  };
+
+  // The finalizer nodes are bump-allocated too, so registration never touches the
+  // global heap.
+  template <class Value>
+  void _defer_destroy_(Value *ptr)
+  {
+    void *const mem = buffer_.allocate(sizeof(_finalizer), alignof(_finalizer));
+    finalizers_     = ::new (mem)
+        _finalizer{+[](void *object) noexcept { std::destroy_at(static_cast<Value *>(object)); },
+                   ptr,
+                   finalizers_};
+  }
+
+  std::pmr::monotonic_buffer_resource buffer_;
+  _finalizer *finalizers_ = nullptr;
+};
+} // namespace any
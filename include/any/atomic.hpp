@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+#include <atomic>
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! atomic_any: a lock-free handoff slot for any<Interface> values.
+//!
+//! Requires an interface declared with interface_options::heap_only, so that an
+//! any<Interface>'s entire state is its one tagged pointer. The slot is then a single
+//! std::atomic<uintptr_t> and store/take/exchange are single atomic word operations —
+//! no mutex, no in-situ branching, no virtual moves. The empty slot holds the bit
+//! pattern of a null _tagged_ptr.
+//!
+//! Note there is no non-consuming load: the slot owns its value, so reading it out
+//! necessarily transfers ownership. Use take() (a consuming load) or empty() to poll.
+template <template <class> class Interface>
+struct atomic_any
+{
+  static_assert(_has_option(iabstract<Interface>::_options, interface_options::heap_only),
+                "atomic_any requires an interface declared with interface_options::heap_only");
+  static_assert(extension_of<iabstract<Interface>, imovable>,
+                "atomic_any requires an interface that extends imovable");
+
+  atomic_any() = default;
+
+  explicit atomic_any(any<Interface> value) noexcept
+    : slot_(_release_(std::move(value)))
+  {
+  }
+
+  atomic_any(atomic_any const &)            = delete;
+  atomic_any &operator=(atomic_any const &) = delete;
+
+  ~atomic_any()
+  {
+    (void)_adopt_(slot_.load(std::memory_order_relaxed));
+  }
+
+  [[nodiscard]]
+  bool is_lock_free() const noexcept
+  {
+    return slot_.is_lock_free();
+  }
+
+  [[nodiscard]]
+  bool empty(std::memory_order order = std::memory_order_acquire) const noexcept
+  {
+    return slot_.load(order) == _empty_bits;
+  }
+
+  //! Atomically replace the slot's contents, destroying the previous value.
+  void store(any<Interface> value) noexcept
+  {
+    (void)exchange(std::move(value));
+  }
+
+  //! Atomically take the slot's contents, leaving the slot empty. A consuming load;
+  //! returns an empty any when the slot was empty.
+  [[nodiscard]]
+  any<Interface> take() noexcept
+  {
+    return _adopt_(slot_.exchange(_empty_bits, std::memory_order_acq_rel));
+  }
+
+  //! Atomically swap the slot's contents with @p value.
+  [[nodiscard]]
+  any<Interface> exchange(any<Interface> value) noexcept
+  {
+    return _adopt_(slot_.exchange(_release_(std::move(value)), std::memory_order_acq_rel));
+  }
+
+  //! Install @p value only if the slot is currently empty (compare-exchange against
+  //! the empty bit pattern). On failure @p value is left untouched and the function
+  //! returns false.
+  [[nodiscard]]
+  bool try_store(any<Interface> &value) noexcept
+  {
+    std::uintptr_t const bits = _release_(std::move(value));
+    std::uintptr_t expected   = _empty_bits;
+    if (slot_.compare_exchange_strong(expected,
+                                      bits,
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_relaxed))
+      return true;
+
+    value = _adopt_(bits); // hand the value back
+    return false;
+  }
+
+private:
+  static constexpr std::uintptr_t _empty_bits = std::bit_cast<std::uintptr_t>(_tagged_ptr());
+
+  //! Surrender ownership of the any's tagged pointer as raw bits, leaving it empty.
+  static std::uintptr_t _release_(any<Interface> &&value) noexcept
+  {
+    auto &ptr                 = *::any::start_lifetime_as<_tagged_ptr>(value.buffer_);
+    std::uintptr_t const bits = std::bit_cast<std::uintptr_t>(std::exchange(ptr, _tagged_ptr()));
+    value._refresh_dispatch_();
+    return bits;
+  }
+
+  //! Adopt raw bits back into an owning any.
+  static any<Interface> _adopt_(std::uintptr_t bits) noexcept
+  {
+    any<Interface> result;
+    *::any::start_lifetime_as<_tagged_ptr>(result.buffer_) = std::bit_cast<_tagged_ptr>(bits);
+    result._refresh_dispatch_();
+    return result;
+  }
+
+  std::atomic<std::uintptr_t> slot_{_empty_bits};
+};
+} // namespace any
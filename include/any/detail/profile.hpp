@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "config.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! ANY_PROFILE: opt-in instrumentation for sizing interface buffers from real data.
+//!
+//! Compile with -DANY_PROFILE=1 and every interface records, per instantiation, how
+//! often emplacement lands in-situ vs. spills to the heap, the size distribution of
+//! the stored models, copy/move/swap counts, and any_cast hit rates. A report is
+//! written to stderr at program exit. When off (the default) every hook expands to
+//! nothing and the library is unchanged.
+
+#if !defined(ANY_PROFILE)
+#  define ANY_PROFILE 0
+#endif
+
+#if ANY_PROFILE
+
+#  include <cstddef>
+#  include <cstdio>
+#  include <cstdlib>
+
+#  include <atomic>
+#  include <string_view>
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// _profile_counters: one set per Interface instantiation, registered in a global
+// intrusive list on first use of the interface and dumped at exit.
+struct _profile_counters
+{
+  using _counter_t = std::atomic<unsigned long long>;
+
+  // model sizes, bucketed as <=8, <=16, ... <=1024, larger
+  static constexpr std::size_t _bucket_count = 9;
+
+  explicit _profile_counters(std::string_view name) noexcept;
+
+  std::string_view name_;
+  _profile_counters *next_ = nullptr;
+
+  _counter_t emplace_in_situ_{0};
+  _counter_t emplace_heap_{0};
+  _counter_t copies_{0};
+  _counter_t moves_{0};
+  _counter_t swaps_{0};
+  _counter_t cast_hits_{0};
+  _counter_t cast_misses_{0};
+  _counter_t size_buckets_[_bucket_count] = {};
+};
+
+inline std::atomic<_profile_counters *> _profile_list{nullptr};
+
+inline void _profile_report() noexcept
+{
+  std::fprintf(stderr, "== any profile ==========================================\n");
+  for (auto *c = _profile_list.load(std::memory_order_acquire); c != nullptr; c = c->next_)
+  {
+    auto const in_situ = c->emplace_in_situ_.load(std::memory_order_relaxed);
+    auto const heap    = c->emplace_heap_.load(std::memory_order_relaxed);
+    auto const total   = in_situ + heap;
+
+    std::fprintf(stderr, "%.*s\n", int(c->name_.size()), c->name_.data());
+    std::fprintf(stderr,
+                 "  emplace: %llu in-situ, %llu heap (%.1f%% spill)\n",
+                 in_situ,
+                 heap,
+                 total ? 100.0 * double(heap) / double(total) : 0.0);
+
+    std::fprintf(stderr, "  model sizes:");
+    for (std::size_t i = 0, limit = 8; i < _profile_counters::_bucket_count; ++i, limit *= 2)
+    {
+      if (auto const n = c->size_buckets_[i].load(std::memory_order_relaxed))
+      {
+        if (i + 1 == _profile_counters::_bucket_count)
+          std::fprintf(stderr, " [>%zu]=%llu", limit / 2, n);
+        else
+          std::fprintf(stderr, " [<=%zu]=%llu", limit, n);
+      }
+    }
+    std::fprintf(stderr, "\n");
+
+    std::fprintf(stderr,
+                 "  copies: %llu  moves: %llu  swaps: %llu\n",
+                 c->copies_.load(std::memory_order_relaxed),
+                 c->moves_.load(std::memory_order_relaxed),
+                 c->swaps_.load(std::memory_order_relaxed));
+    std::fprintf(stderr,
+                 "  any_cast: %llu hits, %llu misses\n",
+                 c->cast_hits_.load(std::memory_order_relaxed),
+                 c->cast_misses_.load(std::memory_order_relaxed));
+  }
+}
+
+inline _profile_counters::_profile_counters(std::string_view name) noexcept
+  : name_(name)
+{
+  next_ = _profile_list.load(std::memory_order_relaxed);
+  while (!_profile_list.compare_exchange_weak(next_,
+                                              this,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed))
+  {
+  }
+
+  static bool const registered = (std::atexit(&_profile_report), true);
+  (void)registered;
+}
+
+inline void _profile_record_size(_profile_counters &counters, std::size_t size) noexcept
+{
+  std::size_t bucket = 0;
+  for (std::size_t limit = 8; bucket + 1 < _profile_counters::_bucket_count && size > limit;
+       limit *= 2)
+  {
+    ++bucket;
+  }
+  counters.size_buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace any
+
+// The hooks live in constexpr functions; the counters are runtime-only.
+#  define ANY_PROFILE_COUNT(_INTERFACE, _COUNTER)                                                  \
+    do                                                                                             \
+    {                                                                                              \
+      if !consteval                                                                                \
+      {                                                                                            \
+        ::any::_profile_of<_INTERFACE>()._COUNTER.fetch_add(1, ::std::memory_order_relaxed);       \
+      }                                                                                            \
+    } while (false)
+
+#  define ANY_PROFILE_MODEL_SIZE(_INTERFACE, _SIZE)                                                \
+    do                                                                                             \
+    {                                                                                              \
+      if !consteval                                                                                \
+      {                                                                                            \
+        ::any::_profile_record_size(::any::_profile_of<_INTERFACE>(), _SIZE);                      \
+      }                                                                                            \
+    } while (false)
+
+#else // ^^^ ANY_PROFILE / !ANY_PROFILE vvv
+
+#  define ANY_PROFILE_COUNT(_INTERFACE, _COUNTER)   ((void)0)
+#  define ANY_PROFILE_MODEL_SIZE(_INTERFACE, _SIZE) ((void)0)
+
+#endif // !ANY_PROFILE
@@ -18,7 +18,11 @@
 
 #include "config.hpp"
 
+#include <cstddef>
+
 #include <compare>
+#include <functional>
+#include <memory>
 #include <source_location>
 #include <string_view>
 
@@ -83,6 +87,21 @@ template <class T>
 inline constexpr std::string_view _pretty_name = _detail::_get_pretty_name<T>();
 
 static_assert(_detail::_pretty_name<int> == "int");
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// _fnv1a_hash: FNV-1a over the pretty name. Evaluated once, during constant
+// initialization of typeid_of<T>, so runtime type checks are integer compares.
+[[nodiscard]]
+constexpr std::size_t _fnv1a_hash(std::string_view str) noexcept
+{
+  std::size_t hash = 14695981039346656037ull;
+  for (char const c : str)
+  {
+    hash ^= static_cast<std::size_t>(static_cast<unsigned char>(c));
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
 } // namespace _detail
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -94,7 +113,7 @@ struct type_info
 
   constexpr explicit type_info(std::string_view name,
                                _detail::std_type_info const *type = nullptr) noexcept
-    : name_(name), type_(type)
+    : name_(name), hash_(_detail::_fnv1a_hash(name)), type_(type)
   {
   }
 
@@ -103,8 +122,27 @@ struct type_info
     return name_;
   }
 
-  auto operator==(type_info const &) const noexcept -> bool                  = default;
-  auto operator<=>(type_info const &) const noexcept -> std::strong_ordering = default;
+  //! A hash of the type's name, precomputed at constant-initialization time.
+  //! Suitable for unordered containers keyed on @c type_index.
+  constexpr std::size_t hash_code() const noexcept
+  {
+    return hash_;
+  }
+
+  //! Since typeid_of<T> is an inline variable, equal types usually compare equal
+  //! by address; otherwise the precomputed hashes decide in O(1), with the name
+  //! comparison reserved for the (vanishingly unlikely) hash collision.
+  [[nodiscard]]
+  constexpr bool operator==(type_info const &other) const noexcept
+  {
+    return this == std::addressof(other) || (hash_ == other.hash_ && name_ == other.name_);
+  }
+
+  [[nodiscard]]
+  constexpr std::strong_ordering operator<=>(type_info const &other) const noexcept
+  {
+    return name_ <=> other.name_;
+  }
 
 #if ANY_HAS_TYPEID
   auto operator==(std::type_info const &other) const noexcept -> bool
@@ -115,6 +153,7 @@ struct type_info
 
 private:
   std::string_view name_;
+  std::size_t hash_;
   _detail::std_type_info const *type_;
 };
 
@@ -143,6 +182,11 @@ struct type_index
     return (*info_).name();
   }
 
+  constexpr std::size_t hash_code() const noexcept
+  {
+    return (*info_).hash_code();
+  }
+
   constexpr bool operator==(type_index const &other) const noexcept
   {
     return *info_ == *other.info_;
@@ -194,3 +238,13 @@ template <type_index Info>
 using typeof_t = typename decltype(_typeid_lookup(_detail::_typeid_c<Info>()))::type;
 
 } // namespace any
+
+template <>
+struct std::hash<::any::type_index>
+{
+  [[nodiscard]]
+  constexpr std::size_t operator()(::any::type_index const &index) const noexcept
+  {
+    return index.hash_code();
+  }
+};
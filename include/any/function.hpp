@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// bad_function_call
+struct bad_function_call : std::exception
+{
+  [[nodiscard]]
+  constexpr char const *what() const noexcept override
+  {
+    return "bad_function_call";
+  }
+};
+
+#if __cpp_exceptions
+[[noreturn]]
+inline void _throw_bad_function_call()
+{
+  throw bad_function_call();
+}
+#else
+[[noreturn]]
+inline constexpr void _throw_bad_function_call() noexcept
+{
+  ::any::_die("bad_function_call\n");
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// _ifunction: the erased interfaces behind function and move_only_function. The call
+// operator stays an ordinary virtual so the erased object composes with the rest of
+// the library (conversions, any_ptr, casts); the wrappers below cache a direct
+// invoker at bind time and only come here for the non-call operations.
+template <class Signature>
+struct _ifunction;
+
+template <class Return, class... Args>
+struct _ifunction<Return(Args...)>
+{
+  template <class Base>
+  struct _copyable : interface<_copyable, Base, extends<icopyable>>
+  {
+    using _copyable::interface::interface;
+
+    constexpr virtual Return operator()(Args... args) const
+    {
+      if constexpr (std::is_void_v<Return>)
+        value(*this)(std::forward<Args>(args)...);
+      else
+        return value(*this)(std::forward<Args>(args)...);
+    }
+  };
+
+  template <class Base>
+  struct _movable : interface<_movable, Base, extends<imovable>>
+  {
+    using _movable::interface::interface;
+
+    constexpr virtual Return operator()(Args... args) const
+    {
+      if constexpr (std::is_void_v<Return>)
+        value(*this)(std::forward<Args>(args)...);
+      else
+        return value(*this)(std::forward<Args>(args)...);
+    }
+  };
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! _function_base: storage plus single-indirection invocation shared by function and
+//! move_only_function. Alongside the erased object it caches a monomorphic invoker
+//! (a plain function pointer) and the stored callable's address, so a call is one
+//! load and one indirect call — no tagged-pointer branch, no virtual dispatch. Every
+//! operation that can move the stored callable refreshes the cached address.
+template <template <class> class Interface, class Return, class... Args>
+struct _function_base
+{
+  _function_base() = default;
+
+  constexpr _function_base(std::nullptr_t) noexcept
+  {
+  }
+
+  template <class Value>
+    requires std::is_invocable_r_v<Return, Value const &, Args...>
+  _function_base(Value value)
+    : fn_(std::move(value))
+  {
+    _bind_<Value>();
+  }
+
+  _function_base(_function_base &&other) noexcept
+    : fn_(std::move(other.fn_))
+    , invoke_(std::exchange(other.invoke_, nullptr))
+  {
+    other.data_ = nullptr;
+    _refresh_();
+  }
+
+  // Only instantiated by function<>, whose interface extends icopyable.
+  _function_base(_function_base const &other)
+    : fn_(other.fn_)
+    , invoke_(other.invoke_)
+  {
+    _refresh_();
+  }
+
+  _function_base &operator=(_function_base &&other) noexcept
+  {
+    _function_base(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  _function_base &operator=(_function_base const &other)
+  {
+    _function_base(other).swap(*this);
+    return *this;
+  }
+
+  _function_base &operator=(std::nullptr_t) noexcept
+  {
+    ::any::reset(fn_);
+    invoke_ = nullptr;
+    data_   = nullptr;
+    return *this;
+  }
+
+  template <class Value>
+    requires std::is_invocable_r_v<Return, Value const &, Args...>
+  _function_base &operator=(Value value)
+  {
+    _function_base(std::move(value)).swap(*this);
+    return *this;
+  }
+
+  Return operator()(Args... args) const
+  {
+    if (invoke_ == nullptr)
+      ::any::_throw_bad_function_call();
+    return invoke_(data_, std::forward<Args>(args)...);
+  }
+
+  [[nodiscard]]
+  explicit operator bool() const noexcept
+  {
+    return invoke_ != nullptr;
+  }
+
+  void swap(_function_base &other) noexcept
+  {
+    fn_.swap(other.fn_);
+    std::swap(invoke_, other.invoke_);
+    _refresh_();
+    other._refresh_();
+  }
+
+  //! The erased object, for the non-call operations (type(), any_cast, conversion to
+  //! extended interfaces). Const, so the cached invoker cannot be desynchronized.
+  [[nodiscard]]
+  any<Interface> const &erased() const noexcept
+  {
+    return fn_;
+  }
+
+private:
+  template <class Value>
+  void _bind_() noexcept
+  {
+    invoke_ = +[](void *obj, Args... args) -> Return {
+      if constexpr (std::is_void_v<Return>)
+        (*static_cast<Value const *>(obj))(std::forward<Args>(args)...);
+      else
+        return (*static_cast<Value const *>(obj))(std::forward<Args>(args)...);
+    };
+    data_ = ::any::data(fn_);
+  }
+
+  void _refresh_() noexcept
+  {
+    data_ = invoke_ != nullptr ? ::any::data(fn_) : nullptr;
+  }
+
+  any<Interface> fn_;
+  Return (*invoke_)(void *, Args...) = nullptr;
+  void *data_                        = nullptr;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! function: a copyable, interface-erased callable with single-indirection calls.
+template <class Signature>
+struct function;
+
+template <class Return, class... Args>
+struct function<Return(Args...)>
+  : _function_base<_ifunction<Return(Args...)>::template _copyable, Return, Args...>
+{
+  using function::_function_base::_function_base;
+  using function::_function_base::operator=;
+
+  function()                            = default;
+  function(function const &)            = default;
+  function(function &&)                 = default;
+  function &operator=(function const &) = default;
+  function &operator=(function &&)      = default;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! move_only_function: as above, for callables that cannot be copied.
+template <class Signature>
+struct move_only_function;
+
+template <class Return, class... Args>
+struct move_only_function<Return(Args...)>
+  : _function_base<_ifunction<Return(Args...)>::template _movable, Return, Args...>
+{
+  using move_only_function::_function_base::_function_base;
+  using move_only_function::_function_base::operator=;
+
+  move_only_function()                                      = default;
+  move_only_function(move_only_function const &)            = delete;
+  move_only_function(move_only_function &&)                 = default;
+  move_only_function &operator=(move_only_function const &) = delete;
+  move_only_function &operator=(move_only_function &&)      = default;
+};
+} // namespace any
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! typed_handle: a revalidating shortcut past the any_cast machinery.
+//!
+//! any_cast re-checks the stored type on every call; any_static_cast skips the check
+//! but is unsound once the slot has been re-emplaced. A typed_handle is the middle
+//! ground for slots that are cast to the same concrete type many times between
+//! mutations: one successful cast caches the payload address, and each later access
+//! revalidates in O(1) — the cached address against data(slot) and the identity of
+//! the stored type against ANY_TYPEID(Value) — before handing the pointer back.
+//! When the slot has been re-emplaced, the handle falls back to a full checked cast
+//! and re-caches, so it stays safe across mutations of any kind.
+//!
+//! The handle does not keep the slot alive and must not outlive it.
+template <class Value>
+struct typed_handle
+{
+  typed_handle() = default;
+
+  //! Bind to the value currently stored in @p slot. The handle is empty when the
+  //! slot holds a different type (or nothing).
+  template <template <class> class Interface, class Base>
+  constexpr explicit typed_handle(Interface<Base> &slot) noexcept
+    : value_(::any::any_cast<Value>(std::addressof(slot)))
+  {
+  }
+
+  [[nodiscard]]
+  constexpr explicit operator bool() const noexcept
+  {
+    return value_ != nullptr;
+  }
+
+  //! True when the cached pointer still designates the value stored in @p slot.
+  template <template <class> class Interface, class Base>
+  [[nodiscard]]
+  constexpr bool valid(Interface<Base> const &slot) const noexcept
+  {
+    return value_ != nullptr && ::any::data(slot) == static_cast<void const *>(value_)
+        && ::any::type(slot) == ANY_TYPEID(Value);
+  }
+
+  //! Return the cached pointer after O(1) revalidation, re-running the checked cast
+  //! (and updating the cache) when @p slot has been re-emplaced. Returns nullptr
+  //! when the slot no longer holds a Value.
+  template <template <class> class Interface, class Base>
+  [[nodiscard]]
+  constexpr Value *try_get(Interface<Base> &slot) noexcept
+  {
+    if (!valid(slot))
+      value_ = ::any::any_cast<Value>(std::addressof(slot));
+    return value_;
+  }
+
+  //! As try_get, but throws bad_any_cast when the slot no longer holds a Value.
+  template <template <class> class Interface, class Base>
+  [[nodiscard]]
+  constexpr Value &get(Interface<Base> &slot)
+  {
+    if (Value *const ptr = try_get(slot))
+      return *ptr;
+    ::any::_throw_bad_any_cast();
+  }
+
+private:
+  Value *value_ = nullptr;
+};
+} // namespace any
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! any_ref: a flat, trivially copyable, non-null view of an object implementing an
+//! interface.
+//!
+//! An @c any_ref is exactly two pointers wide — a vtable pointer and a pointer to the
+//! referent — with no tag bit and no heap spill, so the ABI can pass it in registers
+//! and copying it is a memcpy. Dereferencing never branches: the buffer always holds a
+//! complete in-situ model whose vtable pointer sits at offset zero.
+//!
+//! Unlike @c any_ptr it cannot be null or rebound, and it is runtime-only (no consteval
+//! support). The referent must outlive the view, and a view into an @c any<Interface>
+//! is invalidated when the any's contents are replaced.
+
+//! A root that refers to an object through its abstract interface. Dispatch goes
+//! through the referent's own vtable, so one virtual call reaches the concrete method.
+template <template <class> class Interface>
+struct [[ANY_EMPTY_BASES]] _any_ref_root
+  : iabstract<Interface>
+  , _box_root_kind<_box_kind::_proxy, _root_kind::_reference>
+{
+  using interface_type = iabstract<Interface>;
+  using _any_ref_root::_box_root_kind::_box_kind;
+
+  explicit _any_ref_root(iabstract<Interface> *iface) noexcept
+    : iface_(iface)
+  {
+  }
+
+  template <class Self>
+  [[nodiscard]]
+  constexpr auto &&_value_(this Self &&self) noexcept
+  {
+    return static_cast<_copy_cvref_t<Self &&, iabstract<Interface>>>(*self.iface_);
+  }
+
+  [[nodiscard]]
+  constexpr bool _empty_() const noexcept final override
+  {
+    return false;
+  }
+
+  constexpr void _reset_() noexcept final override
+  {
+    // no-op
+  }
+
+  [[nodiscard]]
+  constexpr type_info const &_type_() const noexcept final override
+  {
+    return type(*iface_);
+  }
+
+  [[nodiscard]]
+  constexpr void *_data_() const noexcept final override
+  {
+    return data(*iface_);
+  }
+
+private:
+  iabstract<Interface> *iface_;
+};
+
+template <template <class> class Interface>
+struct _any_ref_model final
+  : Interface<_mcall<_bases_of<Interface>, _any_ref_root<Interface>>>
+{
+  using _base_t = Interface<_mcall<_bases_of<Interface>, _any_ref_root<Interface>>>;
+  using _base_t::_base_t;
+};
+
+template <template <class> class Interface>
+struct any_ref
+{
+  using interface_type = iabstract<Interface>;
+
+  //! Bind to a concrete object that implements the interface.
+  template <_model_of<Interface> Value>
+    requires(!std::same_as<Value, any_ref>)         //
+         && (!std::same_as<Value, any_ptr<Interface>>)
+         && (!std::same_as<Value, any_const_ptr<Interface>>)
+  any_ref(Value &value) noexcept
+  {
+    using model_type = _reference_model<Interface, Value>;
+    static_assert(sizeof(model_type) <= sizeof(buffer_));
+    ::new (static_cast<void *>(buffer_))
+        model_type(std::addressof(value), static_cast<_iroot *>(nullptr));
+  }
+
+  //! Bind to an @c any<Interface> (or any other type-erased box or reference that
+  //! implements the interface). Proxies are looked through once at construction so
+  //! dereferencing costs a single virtual call.
+  //! @pre !empty(source)
+  template <class Base>
+    requires std::derived_from<Interface<Base>, iabstract<Interface>>
+  any_ref(Interface<Base> &source) noexcept
+  {
+    static_assert(sizeof(_any_ref_model<Interface>) <= sizeof(buffer_));
+    if constexpr (Base::_box_kind == _box_kind::_proxy)
+    {
+      ANY_ASSERT(!empty(source));
+      ::new (static_cast<void *>(buffer_))
+          _any_ref_model<Interface>(std::addressof(value(source)));
+    }
+    else
+    {
+      ::new (static_cast<void *>(buffer_))
+          _any_ref_model<Interface>(static_cast<iabstract<Interface> *>(std::addressof(source)));
+    }
+  }
+
+  //! @pre ptr != nullptr
+  any_ref(any_ptr<Interface> const &ptr) noexcept
+    : any_ref(*ptr)
+  {
+  }
+
+  [[ANY_ALWAYS_INLINE, nodiscard]]
+  inline interface_type &operator*() const noexcept
+  {
+    return *::any::_polymorphic_downcast<interface_type *>(reinterpret_cast<_iroot *>(buffer_));
+  }
+
+  [[ANY_ALWAYS_INLINE, nodiscard]]
+  inline interface_type *operator->() const noexcept
+  {
+    return std::addressof(**this);
+  }
+
+private:
+  // the buffer is mutable so that a const any_ref can return non-const references
+  // from operator-> and operator*, mirroring any_ptr.
+  alignas(void *) mutable std::byte buffer_[2 * sizeof(void *)];
+};
+
+template <template <class> class Interface, class Base>
+any_ref(Interface<Base> &) -> any_ref<Interface>;
+} // namespace any
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <unordered_map>
+
+namespace any
+{
+//! Matched by value types that implement their own wire format. Types that are not
+//! trivially copyable must satisfy this concept to be serialized or registered.
+template <class Value>
+concept _custom_serializable = requires(Value const &value, std::span<std::byte> out) {
+  { value.serialized_size() } -> std::convertible_to<size_t>;
+  { value.serialize(out) } -> std::convertible_to<size_t>;
+};
+
+//! Matched by value types that can reconstruct themselves from serialized bytes.
+template <class Value>
+concept _deserializable = requires(std::span<std::byte const> bytes) {
+  { Value::deserialize(bytes) } -> std::same_as<Value>;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! iserializable
+//!
+//! An interface in the semiregular family that exposes the stored value's wire size
+//! and writes its serialized form into a caller-provided buffer. Trivially copyable
+//! values serialize as their object representation; other values must provide
+//! serialized_size() and serialize(std::span<std::byte>) members.
+template <class Base>
+struct iserializable : interface<iserializable, Base>
+{
+  using iserializable::interface::interface;
+
+  //! The number of bytes serialize() will write. Zero when empty.
+  [[nodiscard]]
+  constexpr size_t serialized_size() const
+  {
+    return _serialized_size_();
+  }
+
+  //! Write the stored value's serialized form to @p out and return the number of
+  //! bytes written.
+  //! @pre out.size() >= serialized_size()
+  size_t serialize(std::span<std::byte> out) const
+  {
+    return _serialize_(out);
+  }
+
+private:
+  [[nodiscard]]
+  constexpr virtual size_t _serialized_size_() const
+  {
+    if (::any::type(*this) == ANY_TYPEID(void))
+      return 0;
+
+    if constexpr (Base::_box_kind == _box_kind::_proxy)
+    {
+      return value(*this).serialized_size();
+    }
+    else if constexpr (Base::_box_kind == _box_kind::_object)
+    {
+      using value_type = value_of_t<iserializable>;
+      if constexpr (std::is_trivially_copyable_v<value_type>)
+      {
+        return sizeof(value_type);
+      }
+      else
+      {
+        static_assert(_custom_serializable<value_type>,
+                      "a value that is not trivially copyable must provide "
+                      "serialized_size() and serialize(std::span<std::byte>) members "
+                      "to be stored behind iserializable");
+        return value(*this).serialized_size();
+      }
+    }
+    else
+    {
+      return ::any::_die<size_t>(_pure_virt_msg, "serialized_size");
+    }
+  }
+
+  virtual size_t _serialize_(std::span<std::byte> out) const
+  {
+    if (::any::type(*this) == ANY_TYPEID(void))
+      return 0;
+
+    if constexpr (Base::_box_kind == _box_kind::_proxy)
+    {
+      return value(*this).serialize(out);
+    }
+    else if constexpr (Base::_box_kind == _box_kind::_object)
+    {
+      using value_type = value_of_t<iserializable>;
+      if constexpr (std::is_trivially_copyable_v<value_type>)
+      {
+        ANY_ASSERT(out.size() >= sizeof(value_type));
+        std::memcpy(out.data(), std::addressof(value(*this)), sizeof(value_type));
+        return sizeof(value_type);
+      }
+      else
+      {
+        return value(*this).serialize(out);
+      }
+    }
+    else
+    {
+      return ::any::_die<size_t>(_pure_virt_msg, "serialize");
+    }
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! type_registry: maps stable type ids to deserialization thunks for one interface.
+//!
+//! The wire id of a registered type is ANY_TYPEID(Value).hash_code() — the FNV-1a
+//! hash of the type's pretty name, which is stable across builds and processes
+//! (unlike a type_index, whose value depends on load addresses). Register every
+//! persisted type at startup; after that, lookups are read-only and thread-safe.
+//!
+//! make() reconstructs an owning any<Interface> from serialized bytes. view() is the
+//! zero-copy path for memory-mapped files: for trivially copyable types it binds a
+//! reference model directly over the mapped bytes — no copy, no allocation — and
+//! returns a null pointer for types that cannot be viewed in place.
+template <template <class> class Interface>
+struct type_registry
+{
+  using interface_type = iabstract<Interface>;
+
+  //! The stable wire identifier for Value.
+  template <_model_of<Interface> Value>
+  [[nodiscard]]
+  static constexpr size_t id_of() noexcept
+  {
+    return ANY_TYPEID(Value).hash_code();
+  }
+
+  //! Register Value under its wire id. Value must either be trivially copyable or
+  //! implement its own wire format: serialized_size()/serialize() members plus a
+  //! static `Value deserialize(std::span<std::byte const>)` factory.
+  template <_model_of<Interface> Value>
+    requires std::is_trivially_copyable_v<Value>
+          || (_custom_serializable<Value> && _deserializable<Value>)
+  static void register_type()
+  {
+    _entries_()[id_of<Value>()] = _entry{&_make_<Value>, _view_thunk_<Value>()};
+  }
+
+  //! Reconstruct an owning any<Interface> from @p bytes. Returns an empty any when
+  //! @p type_id is not registered.
+  [[nodiscard]]
+  static any<Interface> make(size_t type_id, std::span<std::byte const> bytes)
+  {
+    auto const it = _entries_().find(type_id);
+    return it == _entries_().end() ? any<Interface>() : it->second.make_(bytes);
+  }
+
+  //! Bind an interface pointer directly over @p bytes without copying. Returns a
+  //! null pointer when @p type_id is not registered or the registered type is not
+  //! trivially copyable.
+  //! @pre @p bytes is suitably aligned for the registered type
+  [[nodiscard]]
+  static any_const_ptr<Interface> view(size_t type_id, std::span<std::byte const> bytes)
+  {
+    auto const it = _entries_().find(type_id);
+    if (it == _entries_().end() || it->second.view_ == nullptr)
+      return any_const_ptr<Interface>();
+
+    return it->second.view_(bytes);
+  }
+
+private:
+  struct _entry
+  {
+    any<Interface> (*make_)(std::span<std::byte const>);
+    any_const_ptr<Interface> (*view_)(std::span<std::byte const>); // null when not viewable
+  };
+
+  static std::unordered_map<size_t, _entry> &_entries_()
+  {
+    static std::unordered_map<size_t, _entry> entries;
+    return entries;
+  }
+
+  template <class Value>
+  static any<Interface> _make_(std::span<std::byte const> bytes)
+  {
+    if constexpr (std::is_trivially_copyable_v<Value>)
+    {
+      ANY_ASSERT(bytes.size() >= sizeof(Value));
+      alignas(Value) std::byte storage[sizeof(Value)];
+      std::memcpy(storage, bytes.data(), sizeof(Value));
+      return any<Interface>(*::any::start_lifetime_as<Value>(storage));
+    }
+    else
+    {
+      return any<Interface>(Value::deserialize(bytes));
+    }
+  }
+
+  template <class Value>
+  static any_const_ptr<Interface> _view_(std::span<std::byte const> bytes)
+  {
+    ANY_ASSERT(bytes.size() >= sizeof(Value));
+    ANY_ASSERT(reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(Value) == 0);
+    return any_const_ptr<Interface>(reinterpret_cast<Value const *>(bytes.data()));
+  }
+
+  template <class Value>
+  static constexpr auto _view_thunk_() noexcept
+  {
+    if constexpr (std::is_trivially_copyable_v<Value>)
+      return &_view_<Value>;
+    else
+      return nullptr;
+  }
+};
+} // namespace any
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! shared_any: an interface-erased value with O(1) atomic-refcounted copies.
+//!
+//! Copying a @c shared_any bumps an atomic reference count on a shared control block;
+//! only @c mutate() and @c clone() pay for a deep copy through @c icopyable::_copy_to.
+//! Use it when one large parsed value fans out to many consumers that mostly read.
+//!
+//! Shared access is read-only: @c operator* and @c operator-> yield a const reference
+//! to the interface. @c mutate() detaches the value first (copy-on-write) and returns
+//! a mutable reference that is exclusively owned until the next copy is taken.
+template <template <class> class Interface>
+struct shared_any
+{
+  using interface_type = iabstract<Interface>;
+
+  static constexpr bool _movable  = extension_of<interface_type, imovable>;
+  static constexpr bool _copyable = extension_of<interface_type, icopyable>;
+
+  shared_any() = default;
+
+  template <_model_of<Interface> Value>
+  shared_any(Value value)
+  {
+    // Keep the block owned until emplace succeeds; a throwing move or a failed heap
+    // spill must not leak it (the destructor does not run for a thrown constructor).
+    auto block = std::make_unique<_shared_block>();
+    block->value_.template emplace<Value>(std::move(value));
+    block_ = block.release();
+  }
+
+  //! Take ownership of an existing any<Interface> without copying its model.
+  shared_any(any<Interface> value)
+    requires _movable
+    : block_(new _shared_block{.value_ = std::move(value)})
+  {
+  }
+
+  shared_any(shared_any const &other) noexcept
+    : block_(other.block_)
+  {
+    if (block_ != nullptr)
+      block_->refcount_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  shared_any(shared_any &&other) noexcept
+    : block_(std::exchange(other.block_, nullptr))
+  {
+  }
+
+  shared_any &operator=(shared_any other) noexcept
+  {
+    swap(*this, other);
+    return *this;
+  }
+
+  ~shared_any()
+  {
+    if (block_ != nullptr && block_->refcount_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      delete block_;
+  }
+
+  friend void swap(shared_any &lhs, shared_any &rhs) noexcept
+  {
+    std::swap(lhs.block_, rhs.block_);
+  }
+
+  [[nodiscard]]
+  bool empty() const noexcept
+  {
+    return block_ == nullptr || ::any::empty(block_->value_);
+  }
+
+  [[nodiscard]]
+  size_t use_count() const noexcept
+  {
+    return block_ == nullptr ? 0 : block_->refcount_.load(std::memory_order_relaxed);
+  }
+
+  void reset() noexcept
+  {
+    shared_any().swap_(*this);
+  }
+
+  //! @pre !empty()
+  [[ANY_ALWAYS_INLINE, nodiscard]]
+  inline interface_type const &operator*() const noexcept
+  {
+    ANY_ASSERT(!empty());
+    return value(std::as_const(block_->value_));
+  }
+
+  [[ANY_ALWAYS_INLINE, nodiscard]]
+  inline interface_type const *operator->() const noexcept
+  {
+    return std::addressof(**this);
+  }
+
+  //! Deep-copy the stored value into an independent any<Interface>.
+  //! @pre !empty()
+  [[nodiscard]]
+  any<Interface> clone() const
+    requires _copyable
+  {
+    ANY_ASSERT(!empty());
+    return block_->value_;
+  }
+
+  //! Return a mutable reference to the stored value, detaching it first if it is
+  //! shared with other owners (copy-on-write).
+  //! @pre !empty()
+  [[nodiscard]]
+  interface_type &mutate()
+    requires _copyable
+  {
+    ANY_ASSERT(!empty());
+    if (block_->refcount_.load(std::memory_order_acquire) > 1)
+    {
+      auto *const detached = new _shared_block{.value_ = block_->value_}; // deep copy
+      if (block_->refcount_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete block_;
+      block_ = detached;
+    }
+    return value(block_->value_);
+  }
+
+private:
+  struct _shared_block
+  {
+    std::atomic<size_t> refcount_{1};
+    any<Interface> value_;
+  };
+
+  void swap_(shared_any &other) noexcept
+  {
+    std::swap(block_, other.block_);
+  }
+
+  _shared_block *block_ = nullptr;
+};
+} // namespace any
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+#include <ranges>
+#include <span>
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! any_span: an interface view over homogeneous contiguous storage.
+//!
+//! A @c std::vector<any_ptr<Interface>> built from a @c std::vector<Value> pays a
+//! _reference_model bind per element and scatters the traversal across two arrays. An
+//! @c any_span type-erases the whole range at once: it records the base pointer, the
+//! element stride, the length, and a single bind thunk for the concrete type. Its
+//! iterator walks the elements in place and yields @c iabstract<Interface>& views, so
+//! the callee side stays fully generic while traversal remains contiguous.
+//!
+//! Dereferencing rebinds a proxy owned by the iterator — two stores, no allocation —
+//! so the view returned by @c operator* is invalidated by the next dereference of the
+//! same iterator. This is input-iterator semantics; use @c for_each for tight loops.
+
+template <template <class> class Interface, bool IsConst>
+struct _span_iterator
+{
+  using interface_type    = iabstract<Interface>;
+  using reference         = std::conditional_t<IsConst, interface_type const, interface_type> &;
+  using value_type        = interface_type;
+  using difference_type   = std::ptrdiff_t;
+  using iterator_category = std::input_iterator_tag;
+
+  using _bind_fn = void (*)(std::byte *, _reference_proxy_model<Interface> &) noexcept;
+
+  _span_iterator() = default;
+
+  _span_iterator(std::byte *pos, size_t stride, _bind_fn bind) noexcept
+    : pos_(pos)
+    , stride_(stride)
+    , bind_(bind)
+  {
+  }
+
+  // the bound proxy does not travel; the copy rebinds on its next dereference
+  _span_iterator(_span_iterator const &other) noexcept
+    : _span_iterator(other.pos_, other.stride_, other.bind_)
+  {
+  }
+
+  _span_iterator &operator=(_span_iterator const &other) noexcept
+  {
+    pos_    = other.pos_;
+    stride_ = other.stride_;
+    bind_   = other.bind_;
+    return *this;
+  }
+
+  [[nodiscard]]
+  reference operator*() const noexcept
+  {
+    bind_(pos_, reference_);
+    return reference_;
+  }
+
+  _span_iterator &operator++() noexcept
+  {
+    pos_ += stride_;
+    return *this;
+  }
+
+  _span_iterator operator++(int) noexcept
+  {
+    auto copy = *this;
+    ++*this;
+    return copy;
+  }
+
+  [[nodiscard]]
+  bool operator==(_span_iterator const &other) const noexcept
+  {
+    return pos_ == other.pos_;
+  }
+
+private:
+  std::byte *pos_ = nullptr;
+  size_t stride_  = 0;
+  _bind_fn bind_  = nullptr;
+  // mutable so that a const iterator can bind a view in operator*, mirroring
+  // _any_ptr_base::reference_.
+  mutable _reference_proxy_model<Interface> reference_;
+};
+
+template <template <class> class Interface, bool IsConst>
+struct _any_span_base
+{
+  using interface_type = iabstract<Interface>;
+  using iterator       = _span_iterator<Interface, IsConst>;
+  using _bind_fn       = iterator::_bind_fn;
+
+  _any_span_base() = default;
+
+  [[nodiscard]]
+  size_t size() const noexcept
+  {
+    return count_;
+  }
+
+  [[nodiscard]]
+  bool empty() const noexcept
+  {
+    return count_ == 0;
+  }
+
+  [[nodiscard]]
+  iterator begin() const noexcept
+  {
+    return iterator(data_, stride_, bind_);
+  }
+
+  [[nodiscard]]
+  iterator end() const noexcept
+  {
+    return iterator(data_ + count_ * stride_, stride_, bind_);
+  }
+
+  //! Invoke @p fn with an interface view of every element. The bind thunk and
+  //! layout are resolved once for the whole range; the loop is pointer arithmetic
+  //! over the elements in place.
+  template <class Fn>
+  void for_each(Fn &&fn) const
+  {
+    _reference_proxy_model<Interface> reference;
+    for (size_t i = 0; i != count_; ++i)
+    {
+      bind_(data_ + i * stride_, reference);
+      if constexpr (IsConst)
+        fn(std::as_const(static_cast<interface_type &>(reference)));
+      else
+        fn(static_cast<interface_type &>(reference));
+    }
+  }
+
+protected:
+  template <class CvValue>
+  _any_span_base(CvValue *data, size_t count) noexcept
+    : data_(reinterpret_cast<std::byte *>(const_cast<std::remove_cv_t<CvValue> *>(data)))
+    , count_(count)
+    , stride_(sizeof(CvValue))
+    , bind_(&_bind_<CvValue>)
+  {
+  }
+
+  //! A mutable view converts to a const view of the same elements.
+  _any_span_base(_any_span_base<Interface, false> const &other) noexcept
+    requires IsConst
+    : data_(other.data_)
+    , count_(other.count_)
+    , stride_(other.stride_)
+    , bind_(other.bind_)
+  {
+  }
+
+private:
+  template <template <class> class, bool>
+  friend struct _any_span_base;
+
+  //! The one erasure for the whole range: every dereference funnels through this
+  //! thunk, which constructs a _reference_model<Interface, CvValue> in the proxy's
+  //! two-word buffer.
+  template <class CvValue>
+  static void _bind_(std::byte *pos, _reference_proxy_model<Interface> &out) noexcept
+  {
+    out._value_bind_(*reinterpret_cast<CvValue *>(pos));
+  }
+
+  std::byte *data_ = nullptr;
+  size_t count_    = 0;
+  size_t stride_   = 0;
+  _bind_fn bind_   = nullptr;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// any_span
+template <template <class> class Interface>
+struct any_span : _any_span_base<Interface, false>
+{
+  any_span() = default;
+
+  template <_model_of<Interface> Value, size_t Extent>
+  any_span(std::span<Value, Extent> elements) noexcept
+    : _any_span_base<Interface, false>(elements.data(), elements.size())
+  {
+  }
+
+  template <std::ranges::contiguous_range Range>
+    requires _model_of<std::ranges::range_value_t<Range>, Interface>
+          && (!std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range &>>>)
+  any_span(Range &range) noexcept
+    : _any_span_base<Interface, false>(std::ranges::data(range), std::ranges::size(range))
+  {
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// any_const_span
+template <template <class> class Interface>
+struct any_const_span : _any_span_base<Interface, true>
+{
+  any_const_span() = default;
+
+  template <_model_of<Interface> Value, size_t Extent>
+  any_const_span(std::span<Value const, Extent> elements) noexcept
+    : _any_span_base<Interface, true>(elements.data(), elements.size())
+  {
+  }
+
+  template <std::ranges::contiguous_range Range>
+    requires _model_of<std::remove_const_t<std::ranges::range_value_t<Range>>, Interface>
+  any_const_span(Range const &range) noexcept
+    : _any_span_base<Interface, true>(std::ranges::data(range), std::ranges::size(range))
+  {
+  }
+
+  any_const_span(any_span<Interface> const &other) noexcept
+    : _any_span_base<Interface, true>(other)
+  {
+  }
+};
+} // namespace any
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+#include <coroutine>
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! itask: the erased face of a resumable unit of work.
+//!
+//! A coroutine frame always exceeds the default inline buffer, so erasing a frame-owning
+//! callable heap-allocates twice: once for the frame, once for the spilled model. An
+//! any_task (below) owns its frame through a single coroutine handle, so an
+//! @c any<itask> holding one stores a pointer in situ and the only allocation is the
+//! frame itself. The virtual hop here is the scheduler's entry point only; resuming a
+//! task that awaits other tasks proceeds by symmetric transfer, with no virtual calls
+//! between frames.
+template <class Base>
+struct itask : interface<itask, Base, extends<imovable>>
+{
+  using itask::interface::interface;
+
+  //! Run the task until it completes or suspends.
+  constexpr virtual void resume()
+  {
+    value(*this).resume();
+  }
+
+  [[nodiscard]]
+  constexpr virtual bool done() const
+  {
+    return value(*this).done();
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! any_task: a lazy, move-only coroutine that erases into an any<itask> without an
+//! extra allocation.
+//!
+//! The coroutine suspends at its initial suspend point, so creating a task does no
+//! work; awaiting it starts the child by returning its handle from await_suspend
+//! (symmetric transfer), and the child's final suspend resumes the parent the same way.
+//! Lazy start plus symmetric transfer is the shape HALO recognizes: a task created and
+//! awaited in the same scope can have its frame allocation elided entirely. A task
+//! resumed from the top (a scheduler slot) runs until the whole chain suspends or
+//! completes.
+//!
+//! An exception escaping the coroutine body is captured and rethrown where the task is
+//! awaited, or from resume() when a top-level task completes.
+struct any_task
+{
+  struct promise_type;
+
+private:
+  struct _final_awaiter
+  {
+    [[nodiscard]]
+    bool await_ready() const noexcept
+    {
+      return false;
+    }
+
+    [[nodiscard]]
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<promise_type> coro) const noexcept
+    {
+      return coro.promise().continuation_;
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+  };
+
+public:
+  struct promise_type
+  {
+    any_task get_return_object() noexcept
+    {
+      return any_task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept
+    {
+      return {};
+    }
+
+    _final_awaiter final_suspend() noexcept
+    {
+      return {};
+    }
+
+    void return_void() noexcept
+    {
+    }
+
+    void unhandled_exception() noexcept
+    {
+#if __cpp_exceptions
+      exception_ = std::current_exception();
+#else
+      ::any::_die("unhandled exception in any_task\n");
+#endif
+    }
+
+    std::coroutine_handle<> continuation_ = std::noop_coroutine();
+#if __cpp_exceptions
+    std::exception_ptr exception_;
+#endif
+  };
+
+  any_task() = default;
+
+  any_task(any_task &&other) noexcept
+    : coro_(std::exchange(other.coro_, nullptr))
+  {
+  }
+
+  any_task &operator=(any_task &&other) noexcept
+  {
+    any_task(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  ~any_task()
+  {
+    if (coro_ != nullptr)
+      coro_.destroy();
+  }
+
+  void swap(any_task &other) noexcept
+  {
+    std::swap(coro_, other.coro_);
+  }
+
+  [[nodiscard]]
+  explicit operator bool() const noexcept
+  {
+    return coro_ != nullptr;
+  }
+
+  //! Run until completion or the next suspend point. Non-virtual: the handle is
+  //! resumed directly, and any tasks awaited along the way are entered by symmetric
+  //! transfer. @pre bool(*this) && !done()
+  void resume()
+  {
+    ANY_ASSERT(coro_ != nullptr && !coro_.done());
+    coro_.resume();
+#if __cpp_exceptions
+    // A completed top-level task had no awaiter to consume its exception.
+    if (coro_.done() && coro_.promise().exception_ != nullptr)
+      std::rethrow_exception(std::exchange(coro_.promise().exception_, nullptr));
+#endif
+  }
+
+  [[nodiscard]]
+  bool done() const noexcept
+  {
+    return coro_ == nullptr || coro_.done();
+  }
+
+  [[nodiscard]]
+  auto operator co_await() noexcept
+  {
+    struct _awaiter
+    {
+      [[nodiscard]]
+      bool await_ready() const noexcept
+      {
+        return coro_ == nullptr || coro_.done();
+      }
+
+      [[nodiscard]]
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> parent) noexcept
+      {
+        coro_.promise().continuation_ = parent;
+        return coro_; // symmetric transfer into the child
+      }
+
+      void await_resume() const
+      {
+#if __cpp_exceptions
+        // await_ready() short-circuits a null task, so there is no promise to probe.
+        if (coro_ != nullptr && coro_.promise().exception_ != nullptr)
+          std::rethrow_exception(std::exchange(coro_.promise().exception_, nullptr));
+#endif
+      }
+
+      std::coroutine_handle<promise_type> coro_;
+    };
+
+    return _awaiter{coro_};
+  }
+
+private:
+  explicit any_task(std::coroutine_handle<promise_type> coro) noexcept
+    : coro_(coro)
+  {
+  }
+
+  std::coroutine_handle<promise_type> coro_;
+};
+
+//! A moved-from any_task is an inert null handle, so move-plus-destroy is equivalent
+//! to a memcpy and erased tasks take the relocation fast paths.
+template <>
+inline constexpr bool enable_trivially_relocatable<any_task> = true;
+
+//! The whole point: a task in an any<itask> is one pointer and always lives in situ.
+ANY_ASSERT_INLINE(itask, any_task);
+} // namespace any
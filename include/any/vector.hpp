@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! any_vector: a type-segmented container of values implementing an interface.
+//!
+//! Unlike a @c std::vector<any<Interface>>, which scatters payloads between in-situ
+//! buffers and heap blocks, an @c any_vector groups elements by their concrete type into
+//! contiguous arrays of @c _value_model<Interface, Value>. Iteration touches memory
+//! sequentially and resolves each segment's layout exactly once, so batch dispatch over
+//! thousands of elements is limited by the per-element work rather than by cache misses.
+//!
+//! Iteration order is by segment (in order of first insertion of each concrete type) and
+//! then by insertion order within a segment; it is not global insertion order.
+
+//! A raw, type-erased view of one segment's contiguous storage. @c data points at the
+//! first model; successive models are @c stride bytes apart.
+struct _segment_view
+{
+  std::byte *data;
+  size_t count;
+  size_t stride;
+};
+
+template <template <class> class Interface>
+struct _vector_segment_base
+{
+  virtual ~_vector_segment_base() = default;
+
+  [[nodiscard]]
+  virtual type_info const &_type_() const noexcept = 0;
+
+  [[nodiscard]]
+  virtual size_t _size_() const noexcept = 0;
+
+  //! Fetched once per traversal; per-element access is then pure pointer arithmetic.
+  [[nodiscard]]
+  virtual _segment_view _view_() const noexcept = 0;
+
+  virtual void _clear_() noexcept = 0;
+};
+
+template <template <class> class Interface, class Value>
+struct _vector_segment final : _vector_segment_base<Interface>
+{
+  using model_type = _value_model<Interface, Value>;
+
+  [[nodiscard]]
+  type_info const &_type_() const noexcept override
+  {
+    return ANY_TYPEID(Value);
+  }
+
+  [[nodiscard]]
+  size_t _size_() const noexcept override
+  {
+    return models_.size();
+  }
+
+  [[nodiscard]]
+  _segment_view _view_() const noexcept override
+  {
+    // Returning non-const data from a const member mirrors _value_root::_data_;
+    // the const overloads of for_each restore constness at the call site.
+    auto *const data = const_cast<model_type *>(models_.data());
+    return {reinterpret_cast<std::byte *>(data), models_.size(), sizeof(model_type)};
+  }
+
+  void _clear_() noexcept override
+  {
+    models_.clear();
+  }
+
+  std::vector<model_type> models_;
+};
+
+template <template <class> class Interface>
+struct any_vector
+{
+  using interface_type = iabstract<Interface>;
+
+  any_vector() = default;
+
+  template <_model_of<Interface> Value>
+  Value &push_back(Value value)
+  {
+    return emplace_back<Value>(std::move(value));
+  }
+
+  //! Construct a @c Value directly in its segment's contiguous storage.
+  template <_model_of<Interface> Value, class... Args>
+  Value &emplace_back(Args &&...args)
+  {
+    auto &models = _segment_<Value>().models_;
+    auto &model  = models.emplace_back(std::forward<Args>(args)...);
+    ++size_;
+    return value(model);
+  }
+
+  //! Reserve storage for @p count elements of concrete type @c Value.
+  template <_model_of<Interface> Value>
+  void reserve(size_t count)
+  {
+    _segment_<Value>().models_.reserve(count);
+  }
+
+  [[nodiscard]]
+  size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  [[nodiscard]]
+  bool empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  [[nodiscard]]
+  size_t segment_count() const noexcept
+  {
+    return segments_.size();
+  }
+
+  //! The raw view of every segment, for bulk algorithms (see algorithm.hpp). Views
+  //! are invalidated by any mutation of the container.
+  [[nodiscard]]
+  std::vector<_segment_view> _segment_views_() const
+  {
+    std::vector<_segment_view> views;
+    views.reserve(segments_.size());
+    for (auto const &segment : segments_)
+      views.push_back(segment->_view_());
+    return views;
+  }
+
+  void clear() noexcept
+  {
+    for (auto const &segment : segments_)
+      segment->_clear_();
+    size_ = 0;
+  }
+
+  //! Invoke @p fn with an @c iabstract<Interface>& for every element, segment by
+  //! segment. Each segment's layout is resolved with a single virtual call; the
+  //! per-element loop is pointer arithmetic over contiguous storage.
+  template <class Fn>
+  void for_each(Fn &&fn)
+  {
+    for (auto const &segment : segments_)
+    {
+      auto const [data, count, stride] = segment->_view_();
+      for (size_t i = 0; i != count; ++i)
+        fn(_element_(data + i * stride));
+    }
+  }
+
+  template <class Fn>
+  void for_each(Fn &&fn) const
+  {
+    for (auto const &segment : segments_)
+    {
+      auto const [data, count, stride] = segment->_view_();
+      for (size_t i = 0; i != count; ++i)
+        fn(std::as_const(_element_(data + i * stride)));
+    }
+  }
+
+  //! As above, but segments holding one of the named @c Values are traversed with the
+  //! concrete type restored: @p fn is invoked with a @c Value&, the loop body contains
+  //! no indirect calls at all, and the compiler is free to inline and vectorize it.
+  //! Segments of unnamed types fall back to the type-erased traversal.
+  template <class... Values, class Fn>
+    requires(sizeof...(Values) != 0)
+  void for_each(Fn &&fn)
+  {
+    for (auto const &segment : segments_)
+    {
+      if ((_for_each_typed_<Values>(*segment, fn) || ...))
+        continue;
+
+      auto const [data, count, stride] = segment->_view_();
+      for (size_t i = 0; i != count; ++i)
+        fn(_element_(data + i * stride));
+    }
+  }
+
+  template <class... Values, class Fn>
+    requires(sizeof...(Values) != 0)
+  void for_each(Fn &&fn) const
+  {
+    for (auto const &segment : segments_)
+    {
+      if ((_for_each_typed_<Values const>(*segment, fn) || ...))
+        continue;
+
+      auto const [data, count, stride] = segment->_view_();
+      for (size_t i = 0; i != count; ++i)
+        fn(std::as_const(_element_(data + i * stride)));
+    }
+  }
+
+private:
+  //! Find or create the segment for the concrete type @c Value. A linear scan over a
+  //! handful of segments beats a hash lookup, and type_info comparison is O(1).
+  template <class Value>
+  _vector_segment<Interface, Value> &_segment_()
+  {
+    for (auto const &segment : segments_)
+    {
+      if (segment->_type_() == ANY_TYPEID(Value))
+        return static_cast<_vector_segment<Interface, Value> &>(*segment);
+    }
+
+    auto segment = std::make_unique<_vector_segment<Interface, Value>>();
+    return static_cast<_vector_segment<Interface, Value> &>(
+        *segments_.emplace_back(std::move(segment)));
+  }
+
+  template <class CvValue, class Fn, class Value = std::remove_const_t<CvValue>>
+  static bool _for_each_typed_(_vector_segment_base<Interface> const &segment, Fn &fn)
+  {
+    if (segment._type_() != ANY_TYPEID(Value))
+      return false;
+
+    auto const [data, count, stride] = segment._view_();
+    auto *const models = reinterpret_cast<_value_model<Interface, Value> *>(data);
+    for (size_t i = 0; i != count; ++i)
+      fn(static_cast<CvValue &>(value(models[i])));
+    return true;
+  }
+
+  [[nodiscard]]
+  static iabstract<Interface> &_element_(std::byte *bytes) noexcept
+  {
+    return *::any::_polymorphic_downcast<iabstract<Interface> *>(
+        reinterpret_cast<_iroot *>(bytes));
+  }
+
+  std::vector<std::unique_ptr<_vector_segment_base<Interface>>> segments_;
+  size_t size_ = 0;
+};
+} // namespace any
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "any.hpp"
+
+namespace any
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+//! visit: closed-set visitation over the concrete types of an erased value.
+//!
+//! When the full set of concrete types behind an interface is known at the call site,
+//! virtual dispatch through the iabstract vtable is pure overhead: the compiler cannot
+//! inline the bodies. @c visit<Values...> switches on type identity instead — a chain
+//! of O(1) type_info comparisons that the optimizer lowers to a dense dispatch — and
+//! invokes the visitor on the concrete @c Value& recovered with an unchecked static
+//! cast. The visitor bodies inline, and a loop around the visit can vectorize across
+//! them.
+//!
+//! The visitor must be invocable with every listed @c Value& and return the same type
+//! for each alternative. Throws bad_any_cast when the stored type is not among
+//! @c Values; an empty any never matches.
+
+template <class Value, class... Rest, class CvProxy, class Visitor>
+[[ANY_ALWAYS_INLINE]]
+inline constexpr decltype(auto) _visit_(type_info const &type, CvProxy &obj, Visitor &&visitor)
+{
+  if (type == ANY_TYPEID(Value))
+    return std::forward<Visitor>(visitor)(::any::any_static_cast<Value>(obj));
+
+  if constexpr (sizeof...(Rest) != 0)
+    return ::any::_visit_<Rest...>(type, obj, std::forward<Visitor>(visitor));
+  else
+    ::any::_throw_bad_any_cast();
+}
+
+template <class... Values, template <class> class Interface, class Base, class Visitor>
+  requires(sizeof...(Values) != 0)
+constexpr decltype(auto) visit(Interface<Base> &obj, Visitor &&visitor)
+{
+  return ::any::_visit_<Values...>(::any::type(obj), obj, std::forward<Visitor>(visitor));
+}
+
+template <class... Values, template <class> class Interface, class Base, class Visitor>
+  requires(sizeof...(Values) != 0)
+constexpr decltype(auto) visit(Interface<Base> const &obj, Visitor &&visitor)
+{
+  return ::any::_visit_<Values...>(::any::type(obj), obj, std::forward<Visitor>(visitor));
+}
+} // namespace any
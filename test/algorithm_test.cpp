@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/algorithm.hpp"
+
+#include <atomic>
+#include <vector>
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct ishape : any::interface<ishape, Base, any::extends<any::icopyable>>
+{
+  using ishape::interface::interface;
+
+  constexpr virtual int area() const
+  {
+    return any::value(*this).area();
+  }
+};
+
+struct square
+{
+  int area() const
+  {
+    return side * side;
+  }
+
+  int side;
+};
+
+struct circle
+{
+  int area() const
+  {
+    return 3 * radius * radius;
+  }
+
+  int radius;
+};
+} // namespace
+
+TEST_CASE("for_each groups a span by concrete type", "[algorithm]")
+{
+  std::vector<any::any<ishape>> shapes;
+  shapes.emplace_back(square{1});
+  shapes.emplace_back(circle{1});
+  shapes.emplace_back(square{2});
+  shapes.emplace_back(); // empty elements are skipped
+  shapes.emplace_back(circle{2});
+
+  int total   = 0;
+  int flips   = 0; // how often the concrete type changes between consecutive calls
+  void const *last_type = nullptr;
+  any::for_each(std::span(shapes), [&](any::iabstract<ishape> &shape) {
+    total += shape.area();
+    if (last_type != nullptr && last_type != &any::type(shape))
+      ++flips;
+    last_type = &any::type(shape);
+  });
+
+  REQUIRE(total == 1 + 3 + 4 + 12);
+  REQUIRE(flips == 1); // two buckets, one transition
+
+  // const span overload
+  total = 0;
+  any::for_each(std::span<any::any<ishape> const>(shapes),
+                [&](any::iabstract<ishape> const &shape) { total += shape.area(); });
+  REQUIRE(total == 1 + 3 + 4 + 12);
+}
+
+TEST_CASE("parallel_for_each burns through a span on all cores", "[algorithm]")
+{
+  // enough elements for several chunks per type
+  std::vector<any::any<ishape>> shapes;
+  int expected = 0;
+  for (int i = 0; i != 4000; ++i)
+  {
+    if (i % 2 == 0)
+      shapes.emplace_back(square{i % 7});
+    else
+      shapes.emplace_back(circle{i % 5});
+    expected += shapes.back().area();
+  }
+  shapes.emplace_back(); // empty elements are skipped
+
+  std::atomic<int> total{0};
+  any::parallel_for_each(std::span(shapes), [&](any::iabstract<ishape> const &shape) {
+    total.fetch_add(shape.area(), std::memory_order_relaxed);
+  });
+  REQUIRE(total.load() == expected);
+
+  // const span overload, explicit worker count
+  total = 0;
+  any::parallel_for_each(
+      std::span<any::any<ishape> const>(shapes),
+      [&](any::iabstract<ishape> const &shape) {
+        total.fetch_add(shape.area(), std::memory_order_relaxed);
+      },
+      2);
+  REQUIRE(total.load() == expected);
+}
+
+TEST_CASE("parallel_for_each traverses any_vector segments", "[algorithm]")
+{
+  any::any_vector<ishape> shapes;
+  int expected = 0;
+  for (int i = 0; i != 3000; ++i)
+  {
+    if (i % 3 == 0)
+      shapes.emplace_back(circle{i % 5});
+    else
+      shapes.emplace_back(square{i % 7});
+  }
+  shapes.for_each([&](any::iabstract<ishape> const &shape) {
+    expected += shape.area();
+  });
+
+  std::atomic<int> total{0};
+  any::parallel_for_each(shapes, [&](any::iabstract<ishape> &shape) {
+    total.fetch_add(shape.area(), std::memory_order_relaxed);
+  });
+  REQUIRE(total.load() == expected);
+
+  // const overload
+  total = 0;
+  any::parallel_for_each(std::as_const(shapes), [&](any::iabstract<ishape> const &shape) {
+    total.fetch_add(shape.area(), std::memory_order_relaxed);
+  });
+  REQUIRE(total.load() == expected);
+}
@@ -18,7 +18,12 @@
 
 #include <cstdio>
 
+#include <algorithm>
 #include <concepts>
+#include <memory_resource>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "catch2/catch_all.hpp" // IWYU pragma: keep
 
@@ -62,6 +67,14 @@ struct ibaz : any::interface<ibaz, Base, any::extends<ibar>, 5 * sizeof(void *)>
   }
 };
 
+// Compile the erasure machinery for these interfaces here rather than in every
+// translation unit that uses them. (A real program would put the EXTERN half in the
+// interface's header and the INSTANTIATE half in one .cpp file.)
+ANY_EXTERN_INTERFACE(ifoo);
+ANY_EXTERN_INTERFACE(ibaz);
+ANY_INSTANTIATE_INTERFACE(ifoo);
+ANY_INSTANTIATE_INTERFACE(ibaz);
+
 using Small = char;
 using Big   = char[sizeof(any::any<ibaz>) + 1];
 
@@ -250,3 +263,598 @@ TEMPLATE_TEST_CASE("basic usage", "[any]", foobar<Small>, foobar<Big>)
 
   test_deadly_diamond_of_death<TestType>();
 }
+
+namespace
+{
+struct counting_resource final : std::pmr::memory_resource
+{
+  std::size_t allocations   = 0;
+  std::size_t deallocations = 0;
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override
+  {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+
+  void do_deallocate(void *p, std::size_t bytes, std::size_t align) override
+  {
+    ++deallocations;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+
+  bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+} // namespace
+
+TEST_CASE("pmr heap fallback", "[any][pmr]")
+{
+  counting_resource mr;
+  {
+    any::any<ibaz> m(std::allocator_arg, &mr, foobar<Big>{});
+    REQUIRE(!m._in_situ_());
+    REQUIRE(mr.allocations == 1);
+    m.foo();
+
+    // copies are allocated from the same resource as the source block
+    any::any<ibaz> n = m;
+    REQUIRE(mr.allocations == 2);
+
+    // small payloads never touch the resource
+    m.emplace<foobar<Small>>(std::allocator_arg, &mr, foobar<Small>{});
+    REQUIRE(m._in_situ_());
+    REQUIRE(mr.allocations == 2);
+  }
+  REQUIRE(mr.allocations == mr.deallocations);
+}
+
+TEST_CASE("heap block reuse", "[any][emplace]")
+{
+  counting_resource mr;
+  any::any<ibaz> m(std::allocator_arg, &mr, foobar<Big>{});
+  REQUIRE(mr.allocations == 1);
+
+  // refilling with a same-sized payload reuses the existing block
+  m.emplace<foobar<Big>>(std::allocator_arg, &mr, foobar<Big>{});
+  REQUIRE(!m._in_situ_());
+  REQUIRE(mr.allocations == 1);
+  REQUIRE(mr.deallocations == 0);
+
+  // a small payload goes in-situ and releases the block
+  m.emplace<foobar<Small>>(foobar<Small>{});
+  REQUIRE(m._in_situ_());
+  REQUIRE(mr.deallocations == 1);
+
+  // shrink_to_fit right-sizes an oversized reused block
+  using Huge = char[2 * sizeof(Big)];
+  counting_resource mr2;
+  any::any<ibaz> n(std::allocator_arg, &mr2, foobar<Huge>{});
+  n.emplace<foobar<Big>>(std::allocator_arg, &mr2, foobar<Big>{});
+  REQUIRE(mr2.allocations == 1);
+
+  n.shrink_to_fit();
+  REQUIRE(mr2.allocations == 2);
+  REQUIRE(mr2.deallocations == 1);
+  REQUIRE(any::any_cast<foobar<Big>>(n).value == 42);
+}
+
+namespace
+{
+struct assign_probe
+{
+  assign_probe(int value)
+    : value(value)
+  {
+  }
+
+  assign_probe &operator=(assign_probe const &other)
+  {
+    value = other.value;
+    ++assigned;
+    return *this;
+  }
+
+  void foo() {}
+
+  void cfoo() const {}
+
+  int value;
+  int assigned = 0;
+  char pad[64] = {}; // keep the model off the in-situ buffer
+};
+} // namespace
+
+TEST_CASE("same-type assignment fast path", "[any][emplace]")
+{
+  // replacing with the same concrete type assigns through to the stored value
+  // instead of destroying and reconstructing the model
+  any::any<ifoo> a = assign_probe{1};
+  a                = assign_probe{2};
+  REQUIRE(any::any_cast<assign_probe>(a).value == 2);
+  REQUIRE(any::any_cast<assign_probe>(a).assigned == 1);
+
+  // for heap-resident models the block is untouched: no free, no alloc
+  counting_resource mr;
+  any::any<ifoo> b(std::allocator_arg, &mr, assign_probe{1});
+  REQUIRE(mr.allocations == 1);
+
+  b.emplace(std::allocator_arg, &mr, assign_probe{2});
+  REQUIRE(mr.allocations == 1);
+  REQUIRE(mr.deallocations == 0);
+  REQUIRE(any::any_cast<assign_probe>(b).assigned == 1);
+
+  // a different concrete type still takes the replace path
+  b.emplace(std::allocator_arg, &mr, foobar<Small>{});
+  REQUIRE(any::type(b) == ANY_TYPEID(foobar<Small>));
+  REQUIRE(mr.deallocations == 1);
+}
+
+namespace
+{
+struct tracked
+{
+  tracked(int value, int &moves) noexcept
+    : value(value)
+    , moves(&moves)
+  {
+  }
+
+  tracked(tracked &&other) noexcept
+    : value(other.value)
+    , moves(other.moves)
+  {
+    ++*moves;
+  }
+
+  void foo() {}
+
+  void cfoo() const {}
+
+  int value;
+  int *moves;
+};
+} // namespace
+
+TEST_CASE("in-place construction", "[any][emplace]")
+{
+  int moves = 0;
+
+  any::any<ifoo> a(std::in_place_type<tracked>, 7, moves);
+  REQUIRE(moves == 0);
+  REQUIRE(any::any_cast<tracked>(a).value == 7);
+
+  auto b = any::make_any<ifoo, tracked>(8, moves);
+  REQUIRE(moves == 0);
+  REQUIRE(any::any_cast<tracked>(b).value == 8);
+
+  // heap spills of in-place constructions come from the given resource
+  counting_resource mr;
+  auto c = any::any<ibaz>(std::allocator_arg, &mr, std::in_place_type<foobar<Big>>);
+  REQUIRE(!c._in_situ_());
+  REQUIRE(mr.allocations == 1);
+}
+
+namespace
+{
+// constant-initialized: laid down in the binary, no startup construction
+constinit any::static_any<ibaz, foobar<Small>> static_instance{foobar<Small>{}};
+} // namespace
+
+TEST_CASE("static_any", "[any][static]")
+{
+  REQUIRE(any::type(*static_instance) == ANY_TYPEID(foobar<Small>));
+  REQUIRE(any::value(*static_instance).value == 42);
+  static_instance->foo();
+  static_instance->baz();
+
+  // copies into a full-fat any
+  any::any<ibaz> copy = static_instance;
+  REQUIRE(any::any_cast<foobar<Small>>(copy) == any::value(*static_instance));
+
+  // in-place construction is constexpr too
+  constexpr any::static_any<ibaz, foobar<Small>> local{std::in_place};
+  REQUIRE(any::value(*local).value == 42);
+}
+
+namespace
+{
+template <class Base>
+struct ifast
+  : any::interface<ifast,
+                   Base,
+                   any::extends<any::icopyable>,
+                   any::default_buffer_size,
+                   alignof(std::max_align_t),
+                   any::interface_options::direct_dispatch>
+{
+  using ifast::interface::interface;
+
+  constexpr virtual int get() const
+  {
+    return any::value(*this).get();
+  }
+};
+
+template <class State>
+struct payload
+{
+  int get() const
+  {
+    return v;
+  }
+
+  int v = 0;
+  State state{};
+};
+
+using small_payload = payload<char>;
+using big_payload   = payload<char[sizeof(any::any<ifast>) + 1]>;
+} // namespace
+
+static_assert(any::_value_proxy_root<ifast>::_direct_dispatch);
+static_assert(!any::_value_proxy_root<ibaz>::_direct_dispatch);
+
+TEST_CASE("direct dispatch option", "[any][options]")
+{
+  any::any<ifast> m = small_payload{1};
+  REQUIRE(m._in_situ_());
+  REQUIRE(m.get() == 1);
+
+  any::any<ifast> n = big_payload{2};
+  REQUIRE(!n._in_situ_());
+  REQUIRE(n.get() == 2);
+
+  // the cached pointer follows copies, swaps, moves, assignments and resets
+  auto copy = m;
+  REQUIRE(copy.get() == 1);
+
+  swap(m, n);
+  REQUIRE(m.get() == 2);
+  REQUIRE(n.get() == 1);
+
+  auto moved = std::move(m);
+  REQUIRE(moved.get() == 2);
+
+  n = small_payload{3};
+  REQUIRE(n.get() == 3);
+  REQUIRE(any::any_cast<small_payload>(n).v == 3);
+
+  n.emplace<big_payload>(big_payload{4});
+  REQUIRE(n.get() == 4);
+
+  any::reset(n);
+  REQUIRE(any::empty(n));
+}
+
+namespace
+{
+template <class Base>
+struct ipinned
+  : any::interface<ipinned,
+                   Base,
+                   any::extends<any::icopyable>,
+                   any::default_buffer_size,
+                   alignof(std::max_align_t),
+                   any::interface_options::heap_only>
+{
+  using ipinned::interface::interface;
+
+  constexpr virtual int get() const
+  {
+    return any::value(*this).get();
+  }
+};
+
+template <class Base>
+struct ipinned_ext : any::interface<ipinned_ext, Base, any::extends<ipinned>>
+{
+  using ipinned_ext::interface::interface;
+};
+} // namespace
+
+// heap_only collapses the in-situ buffer to one tagged pointer...
+static_assert(any::iabstract<ipinned>::_buffer_size == sizeof(void *));
+static_assert(sizeof(any::any<ipinned>) == 2 * sizeof(void *)); // vptr + tagged pointer
+// ...and makes derived-to-base conversion between heap_only interfaces noexcept
+static_assert(std::is_nothrow_constructible_v<any::any<ipinned>, any::any<ipinned_ext>>);
+static_assert(!std::is_nothrow_constructible_v<any::any<ifoo>, any::any<ibaz>>);
+
+TEST_CASE("heap_only storage policy", "[any][options]")
+{
+  counting_resource mr;
+  {
+    any::any<ipinned_ext> a(std::allocator_arg, &mr, small_payload{7});
+    REQUIRE(!a._in_situ_());
+    REQUIRE(mr.allocations == 1);
+    REQUIRE(a.get() == 7);
+
+    // derived-to-base conversion steals the heap pointer: no allocation, no move
+    any::any<ipinned> b = std::move(a);
+    REQUIRE(mr.allocations == 1);
+    REQUIRE(mr.deallocations == 0);
+    REQUIRE(any::empty(a));
+    REQUIRE(b.get() == 7);
+  }
+  REQUIRE(mr.allocations == mr.deallocations);
+}
+
+static_assert(any::enable_trivially_relocatable<int>);
+static_assert(any::enable_trivially_relocatable<foobar<Small>>);
+static_assert(!any::enable_trivially_relocatable<counting_resource>); // virtual dtor
+
+TEST_CASE("trivially relocatable fast paths", "[any][relocate]")
+{
+  any::any<ibaz> a(foobar<Small>{});
+  any::any<ibaz> b(foobar<Small>{});
+  any::any_cast<foobar<Small>>(a).value = 1;
+  any::any_cast<foobar<Small>>(b).value = 2;
+
+  // in-situ/in-situ swap is a byte-wise buffer swap
+  swap(a, b);
+  REQUIRE(any::any_cast<foobar<Small>>(a).value == 2);
+  REQUIRE(any::any_cast<foobar<Small>>(b).value == 1);
+
+  // mixed in-situ/heap swap still byte-swaps when the in-situ model is relocatable
+  any::any<ibaz> c(foobar<Big>{});
+  REQUIRE(!c._in_situ_());
+  swap(a, c);
+  REQUIRE(any::type(a) == ANY_TYPEID(foobar<Big>));
+  REQUIRE(any::any_cast<foobar<Small>>(c).value == 2);
+
+  // move construction into an empty any relocates with memcpy
+  any::any<ibaz> d = std::move(b);
+  REQUIRE(any::any_cast<foobar<Small>>(d).value == 1);
+  REQUIRE(any::empty(b));
+
+  // conversion to a smaller-buffered any relocates when the model still fits
+  any::any<ifoo> e = std::move(d);
+  REQUIRE(any::type(e) == ANY_TYPEID(foobar<Small>));
+}
+
+namespace
+{
+// larger than ibar's buffer and not trivially relocatable
+struct chunky
+{
+  void foo() {}
+
+  void cfoo() const {}
+
+  void bar() {}
+
+  std::string data = "payload";
+};
+} // namespace
+
+TEST_CASE("flatten canonicalizes converted storage", "[any][flatten]")
+{
+  // pointer-stealing conversion leaves the derived interface's model behind;
+  // flatten rebuilds the canonical one without changing observable behavior
+  any::any<ibaz> m(foobar<Small>{});
+  any::any<ibar> n = std::move(m);
+  REQUIRE(n._in_situ_());
+  n.flatten();
+  REQUIRE(n._in_situ_());
+  REQUIRE(any::type(n) == ANY_TYPEID(foobar<Small>));
+  n.bar();
+
+  // flatten releases an oversized reused block holding a model that
+  // shrink_to_fit cannot move (chunky is not trivially relocatable)
+  counting_resource mr;
+  any::any<ibar> big(std::allocator_arg, &mr, foobar<Big>{});
+  REQUIRE(mr.allocations == 1);
+  big.emplace<chunky>(std::allocator_arg, &mr);
+  REQUIRE(mr.allocations == 1); // block reused
+  big.shrink_to_fit();
+  REQUIRE(mr.deallocations == 0); // no effect
+  big.flatten();
+  REQUIRE(mr.deallocations == 1); // oversized block released
+  REQUIRE(any::type(big) == ANY_TYPEID(chunky));
+  REQUIRE(any::any_cast<chunky>(big).data == "payload");
+
+  // a no-op on an empty any
+  any::any<ibar> e;
+  e.flatten();
+  REQUIRE(any::empty(e));
+}
+
+static_assert(ANY_TYPEID(int).hash_code() == ANY_TYPEID(int).hash_code());
+static_assert(ANY_TYPEID(int).hash_code() != ANY_TYPEID(long).hash_code());
+static_assert(ANY_TYPEID(int) == ANY_TYPEID(int));
+static_assert(ANY_TYPEID(int) != ANY_TYPEID(long));
+
+TEST_CASE("type_info hashing", "[typeinfo]")
+{
+  any::type_index const i = ANY_TYPEID(int);
+  any::type_index const j = ANY_TYPEID(long);
+
+  REQUIRE(i.hash_code() == ANY_TYPEID(int).hash_code());
+  REQUIRE(std::hash<any::type_index>{}(i) == i.hash_code());
+  REQUIRE(i.hash_code() != j.hash_code());
+
+  any::any<ibaz> m(foobar<Small>{});
+  REQUIRE(any::type(m).hash_code() == ANY_TYPEID(foobar<Small>).hash_code());
+}
+
+TEST_CASE("ihashable and std::hash", "[any][hash]")
+{
+  any::any<any::isemiregular> a = 42;
+  any::any<any::isemiregular> b = 42;
+  any::any<any::isemiregular> c = 43;
+
+  // equal values hash equal; the type identity is mixed in
+  REQUIRE(a.hash() == b.hash());
+  REQUIRE(a.hash() != any::any<any::isemiregular>(42L).hash());
+
+  any::any<any::isemiregular> empty;
+  REQUIRE(empty.hash() == 0);
+
+  std::unordered_set<any::any<any::isemiregular>> keys;
+  keys.insert(a);
+  keys.insert(b); // duplicate of a
+  keys.insert(c);
+  keys.insert(std::string("forty-two"));
+  REQUIRE(keys.size() == 3);
+  REQUIRE(keys.contains(any::any<any::isemiregular>(43)));
+  REQUIRE(!keys.contains(any::any<any::isemiregular>(44)));
+}
+
+namespace
+{
+template <class Base>
+struct isortable
+  : any::interface<isortable, Base, any::extends<any::icopyable, any::iordered>>
+{
+  using isortable::interface::interface;
+};
+} // namespace
+
+TEST_CASE("iordered total ordering", "[any][ordered]")
+{
+  any::any<isortable> one = 1;
+  any::any<isortable> two = 2;
+  REQUIRE(one < two);
+  REQUIRE(two > one);
+  REQUIRE((one <=> any::any<isortable>(1)) == std::strong_ordering::equal);
+
+  // empty anys compare equal to each other
+  REQUIRE((any::any<isortable>() <=> any::any<isortable>()) == std::strong_ordering::equal);
+
+  // a heterogeneous sort groups by concrete type, ordered within each group
+  std::vector<any::any<isortable>> values;
+  values.emplace_back(3);
+  values.emplace_back(std::string("b"));
+  values.emplace_back(1);
+  values.emplace_back(2.5);
+  values.emplace_back(std::string("a"));
+  values.emplace_back(1.5);
+  values.emplace_back(2);
+  std::sort(values.begin(), values.end());
+
+  int flips             = 0;
+  void const *last_type = nullptr;
+  for (auto const &v : values)
+  {
+    if (last_type != nullptr && last_type != &any::type(v))
+      ++flips;
+    last_type = &any::type(v);
+  }
+  REQUIRE(flips == 2); // three type groups, each contiguous
+
+  std::vector<int> ints;
+  std::vector<double> doubles;
+  for (auto const &v : values)
+  {
+    if (any::type(v) == ANY_TYPEID(int))
+      ints.push_back(any::any_cast<int>(v));
+    else if (any::type(v) == ANY_TYPEID(double))
+      doubles.push_back(any::any_cast<double>(v));
+  }
+  REQUIRE(ints == std::vector<int>{1, 2, 3});
+  REQUIRE(doubles == std::vector<double>{1.5, 2.5});
+}
+
+// The introspection surfaces are compile-time constants; exercise them with
+// static_asserts so a regression fails the build rather than a test run.
+static_assert(any::storage_report<ibaz>::buffer_size == 5 * sizeof(void *));
+static_assert(any::storage_report<ibaz>::buffer_alignment == alignof(std::max_align_t));
+static_assert(any::storage_report<ibaz>::footprint == sizeof(any::any<ibaz>));
+
+// ibaz's buffer was grown locally; its one direct base demands only the default.
+static_assert(any::storage_report<ibaz>::contributing_bases.size() == 1);
+static_assert(any::storage_report<ibaz>::contributing_bases[0].interface
+              == &ANY_TYPEID(any::iabstract<ibar>));
+static_assert(any::storage_report<ibaz>::contributing_bases[0].buffer_size
+              == any::default_buffer_size);
+
+// fits_inline mirrors the emplace path's storage decision exactly.
+static_assert(any::fits_inline<ibaz, foobar<Small>>);
+static_assert(!any::fits_inline<ibaz, foobar<Big>>);
+static_assert(any::required_buffer_for<ibaz, foobar<Big>> > any::storage_report<ibaz>::buffer_size);
+static_assert(any::fits_inline<ibar, foobar<Small>>);
+ANY_ASSERT_INLINE(ibaz, foobar<Small>);
+
+// A heap_only interface stores nothing inline, however small.
+static_assert(any::storage_report<ipinned>::buffer_size == sizeof(void *));
+static_assert(!any::fits_inline<ipinned, int>);
+
+TEST_CASE("storage introspection", "[any][storage]")
+{
+  // the reported numbers agree with the observed storage decisions
+  any::any<ibaz> small{foobar<Small>()};
+  any::any<ibaz> big{foobar<Big>()};
+  REQUIRE(small._in_situ_());
+  REQUIRE(!big._in_situ_());
+
+  // a buffer sized by required_buffer_for holds every listed value inline
+  constexpr size_t needed = any::required_buffer_for<ibaz, foobar<Small>, foobar<Big>>;
+  REQUIRE(needed >= sizeof(foobar<Big>));
+}
+
+namespace
+{
+// Copy-only: moves fall back to the (counted) copy constructor, so any extra
+// construction on the conversion path is visible in the count.
+struct copy_probe
+{
+  copy_probe() = default;
+
+  copy_probe(copy_probe const &other) noexcept
+    : copies(other.copies + 1)
+  {
+  }
+
+  int next() const
+  {
+    return copies;
+  }
+
+  int copies = 0;
+};
+
+template <class Base>
+struct iprobe : any::interface<iprobe, Base, any::extends<any::icopyable>>
+{
+  using iprobe::interface::interface;
+
+  constexpr virtual int next() const
+  {
+    return any::value(*this).next();
+  }
+};
+} // namespace
+
+TEST_CASE("materializing an owned value from a view copies once", "[any][convert]")
+{
+  copy_probe original;
+
+  // from a pointer bound directly to the value
+  any::any_const_ptr<iprobe> ptr = &original;
+  any::any<iprobe> owned         = *ptr;
+  REQUIRE(any::type(owned) == ANY_TYPEID(copy_probe));
+  REQUIRE(any::any_cast<copy_probe>(owned).copies == 1);
+
+  // from a pointer into another any
+  any::any<iprobe> source{copy_probe()};
+  int const base               = any::any_cast<copy_probe>(source).copies;
+  any::any_ptr<iprobe> aptr    = any::addressof(source);
+  any::any<iprobe> from_stored = *aptr;
+  REQUIRE(any::any_cast<copy_probe>(from_stored).copies == base + 1);
+
+  // assignment materializes the same way
+  from_stored = *ptr;
+  REQUIRE(any::any_cast<copy_probe>(from_stored).copies == 1);
+
+  // assigning a view of the stored value to its owner is a no-op
+  any::any_ptr<iprobe> self = any::addressof(owned);
+  owned                     = *self;
+  REQUIRE(any::any_cast<copy_probe>(owned).copies == 1);
+
+  // a null view produces an empty any
+  any::any<iprobe> from_null = *any::any_ptr<iprobe>();
+  REQUIRE(any::empty(from_null));
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/arena.hpp"
+
+#include <memory_resource>
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct inum : any::interface<inum, Base>
+{
+  using inum::interface::interface;
+
+  constexpr virtual int get() const
+  {
+    return any::value(*this).get();
+  }
+};
+
+int live = 0;
+
+struct tracked
+{
+  explicit tracked(int v)
+    : v_(v)
+  {
+    ++live;
+  }
+
+  ~tracked()
+  {
+    --live;
+  }
+
+  int get() const
+  {
+    return v_;
+  }
+
+  int v_;
+};
+
+struct plain
+{
+  int get() const
+  {
+    return v_;
+  }
+
+  int v_;
+};
+
+struct spiller
+{
+  int get() const
+  {
+    return v_;
+  }
+
+  int v_;
+  char padding_[4 * sizeof(void *)]{};
+};
+
+struct counting_resource final : std::pmr::memory_resource
+{
+  std::size_t allocations   = 0;
+  std::size_t deallocations = 0;
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override
+  {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, align);
+  }
+
+  void do_deallocate(void *p, std::size_t bytes, std::size_t align) override
+  {
+    ++deallocations;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+
+  bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+} // namespace
+
+TEST_CASE("any_arena bulk teardown", "[arena]")
+{
+  counting_resource upstream;
+  {
+    any::any_arena arena(1024, &upstream);
+
+    auto p = arena.emplace<inum, tracked>(1);
+    auto q = arena.emplace<inum, plain>(2);
+    REQUIRE(p->get() == 1);
+    REQUIRE(q->get() == 2);
+    REQUIRE(live == 1);
+
+    // many objects, one upstream allocation
+    for (int i = 0; i < 16; ++i)
+      (void)arena.emplace<inum, plain>(i);
+    REQUIRE(upstream.allocations == 1);
+
+    // heap spills of any<> objects can be tied to the arena's lifetime too
+    any::any<inum> a(std::allocator_arg, arena.resource(), spiller{3});
+    REQUIRE(!a._in_situ_());
+    REQUIRE(a.get() == 3);
+  }
+  // non-trivial destructors ran; everything went back upstream in bulk
+  REQUIRE(live == 0);
+  REQUIRE(upstream.allocations == upstream.deallocations);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/atomic.hpp"
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct islot
+  : any::interface<islot,
+                   Base,
+                   any::extends<any::icopyable>,
+                   any::default_buffer_size,
+                   alignof(std::max_align_t),
+                   any::interface_options::heap_only>
+{
+  using islot::interface::interface;
+
+  constexpr virtual int get() const
+  {
+    return any::value(*this).get();
+  }
+};
+
+int live = 0;
+
+struct job
+{
+  explicit job(int v)
+    : v_(v)
+  {
+    ++live;
+  }
+
+  job(job const &other)
+    : v_(other.v_)
+  {
+    ++live;
+  }
+
+  job(job &&other) noexcept
+    : v_(other.v_)
+  {
+    ++live;
+  }
+
+  ~job()
+  {
+    --live;
+  }
+
+  int get() const
+  {
+    return v_;
+  }
+
+  int v_;
+};
+} // namespace
+
+TEST_CASE("atomic_any handoff slot", "[atomic]")
+{
+  {
+    any::atomic_any<islot> slot;
+    REQUIRE(slot.empty());
+    REQUIRE(any::empty(slot.take()));
+
+    slot.store(any::any<islot>(job{1}));
+    REQUIRE(!slot.empty());
+
+    auto prev = slot.exchange(any::any<islot>(job{2}));
+    REQUIRE(prev.get() == 1);
+
+    auto taken = slot.take();
+    REQUIRE(taken.get() == 2);
+    REQUIRE(slot.empty());
+
+    // try_store succeeds only on an empty slot
+    any::any<islot> a(job{3});
+    REQUIRE(slot.try_store(a));
+    REQUIRE(any::empty(a));
+
+    any::any<islot> b(job{4});
+    REQUIRE(!slot.try_store(b));
+    REQUIRE(b.get() == 4); // handed back intact
+
+    // a value left in the slot is destroyed with it
+  }
+  REQUIRE(live == 0);
+}
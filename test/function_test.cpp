@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/function.hpp"
+
+#include <memory>
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+TEST_CASE("function basics", "[function]")
+{
+  any::function<int(int)> f;
+  REQUIRE(!f);
+  REQUIRE_THROWS_AS(f(1), any::bad_function_call);
+
+  f = [](int x) {
+    return x + 1;
+  };
+  REQUIRE(f);
+  REQUIRE(f(1) == 2);
+
+  // copies are independent
+  auto g = f;
+  REQUIRE(g(2) == 3);
+
+  int const bias = 10;
+  f              = [bias](int x) {
+    return x + bias;
+  };
+  REQUIRE(f(5) == 15);
+  REQUIRE(g(2) == 3);
+
+  // the cached callable address follows swaps and moves
+  f.swap(g);
+  REQUIRE(f(2) == 3);
+  REQUIRE(g(5) == 15);
+
+  auto h = std::move(g);
+  REQUIRE(!g);
+  REQUIRE(h(5) == 15);
+
+  f = nullptr;
+  REQUIRE(!f);
+
+  // non-call operations go through the erased object
+  REQUIRE(!any::empty(h.erased()));
+  REQUIRE(any::type(h.erased()) != ANY_TYPEID(void));
+}
+
+TEST_CASE("move_only_function", "[function]")
+{
+  static_assert(!std::is_copy_constructible_v<any::move_only_function<int()>>);
+  static_assert(!std::is_copy_assignable_v<any::move_only_function<int()>>);
+
+  auto p                          = std::make_unique<int>(7);
+  any::move_only_function<int()> f = [p = std::move(p)] {
+    return *p;
+  };
+  REQUIRE(f() == 7);
+
+  auto g = std::move(f);
+  REQUIRE(!f);
+  REQUIRE(g() == 7);
+
+  g = nullptr;
+  REQUIRE(!g);
+}
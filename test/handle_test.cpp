@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/handle.hpp"
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct ievent : any::interface<ievent, Base>
+{
+  using ievent::interface::interface;
+
+  constexpr virtual int kind() const
+  {
+    return any::value(*this).kind();
+  }
+};
+
+struct tick
+{
+  constexpr int kind() const
+  {
+    return 1;
+  }
+
+  int count = 0;
+};
+
+struct quit
+{
+  constexpr int kind() const
+  {
+    return 2;
+  }
+};
+} // namespace
+
+TEST_CASE("typed_handle caches a validated cast", "[handle]")
+{
+  any::any<ievent> slot = tick{};
+
+  any::typed_handle<tick> handle(slot);
+  REQUIRE(handle);
+  REQUIRE(handle.valid(slot));
+
+  // repeated accesses reuse the cached pointer
+  for (int i = 0; i != 5; ++i)
+    ++handle.get(slot).count;
+  REQUIRE(any::any_cast<tick>(slot).count == 5);
+
+  // re-emplacing the same type revalidates transparently
+  slot = tick{.count = 100};
+  REQUIRE(handle.try_get(slot) != nullptr);
+  REQUIRE(handle.get(slot).count == 100);
+
+  // a type change invalidates the handle; get throws, try_get returns null
+  slot.emplace<quit>();
+  REQUIRE(!handle.valid(slot));
+  REQUIRE(handle.try_get(slot) == nullptr);
+  REQUIRE_THROWS_AS(handle.get(slot), any::bad_any_cast);
+
+  // and storing a tick again heals it
+  slot = tick{.count = 7};
+  REQUIRE(handle.get(slot).count == 7);
+
+  // a handle bound to a mismatched slot starts out empty
+  any::typed_handle<quit> wrong(slot);
+  REQUIRE(!wrong);
+  REQUIRE(wrong.try_get(slot) == nullptr);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/ref.hpp"
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct icount : any::interface<icount, Base, any::extends<any::icopyable>>
+{
+  using icount::interface::interface;
+
+  constexpr virtual int next()
+  {
+    return any::value(*this).next();
+  }
+};
+
+struct counter
+{
+  int next()
+  {
+    return ++count;
+  }
+
+  int count = 0;
+};
+} // namespace
+
+static_assert(std::is_trivially_copyable_v<any::any_ref<icount>>);
+static_assert(sizeof(any::any_ref<icount>) == 2 * sizeof(void *));
+
+TEST_CASE("any_ref is a flat view", "[any_ref]")
+{
+  counter c;
+  any::any_ref<icount> ref = c;
+  REQUIRE(ref->next() == 1);
+  REQUIRE((*ref).next() == 2);
+  REQUIRE(c.count == 2);
+  REQUIRE(any::type(*ref) == ANY_TYPEID(counter));
+  REQUIRE(any::data(*ref) == &c);
+
+  // copies view the same object
+  any::any_ref<icount> copy = ref;
+  REQUIRE(copy->next() == 3);
+  REQUIRE(c.count == 3);
+
+  // views into an any<Interface> dispatch to the stored value
+  any::any<icount> a = counter{};
+  any::any_ref<icount> aref(a);
+  REQUIRE(aref->next() == 1);
+  REQUIRE(any::any_cast<counter>(a).count == 1);
+  REQUIRE(any::data(*aref) == any::data(a));
+
+  // views from an any_ptr
+  any::any_ptr<icount> ptr = any::addressof(a);
+  any::any_ref<icount> pref(ptr);
+  REQUIRE(pref->next() == 2);
+
+  // deduction from a type-erased source
+  any::any_ref deduced(a);
+  REQUIRE(deduced->next() == 3);
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/serialize.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct irecord
+  : any::interface<irecord, Base, any::extends<any::icopyable, any::iserializable>>
+{
+  using irecord::interface::interface;
+
+  constexpr virtual int sum() const
+  {
+    return any::value(*this).sum();
+  }
+};
+
+// serialized as its object representation
+struct point
+{
+  int x;
+  int y;
+
+  int sum() const
+  {
+    return x + y;
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<point>);
+
+// serializes through its own members
+struct label
+{
+  std::string text_;
+
+  size_t serialized_size() const
+  {
+    return text_.size();
+  }
+
+  size_t serialize(std::span<std::byte> out) const
+  {
+    std::memcpy(out.data(), text_.data(), text_.size());
+    return text_.size();
+  }
+
+  static label deserialize(std::span<std::byte const> bytes)
+  {
+    return label{std::string(reinterpret_cast<char const *>(bytes.data()), bytes.size())};
+  }
+
+  int sum() const
+  {
+    return static_cast<int>(text_.size());
+  }
+};
+
+using registry = any::type_registry<irecord>;
+} // namespace
+
+TEST_CASE("iserializable round trip through the registry", "[serialize]")
+{
+  registry::register_type<point>();
+  registry::register_type<label>();
+
+  any::any<irecord> a = point{3, 4};
+  REQUIRE(a.serialized_size() == sizeof(point));
+
+  std::vector<std::byte> bytes(a.serialized_size());
+  REQUIRE(a.serialize(bytes) == bytes.size());
+
+  auto b = registry::make(registry::id_of<point>(), bytes);
+  REQUIRE(!any::empty(b));
+  REQUIRE(any::type(b) == ANY_TYPEID(point));
+  REQUIRE(b.sum() == 7);
+
+  // a type with a custom wire format
+  any::any<irecord> c = label{"hello"};
+  REQUIRE(c.serialized_size() == 5);
+
+  bytes.resize(c.serialized_size());
+  REQUIRE(c.serialize(bytes) == 5);
+
+  auto d = registry::make(registry::id_of<label>(), bytes);
+  REQUIRE(d.sum() == 5);
+
+  // an unregistered id yields an empty any
+  REQUIRE(any::empty(registry::make(~size_t(0), bytes)));
+
+  // an empty any serializes to nothing
+  REQUIRE(any::any<irecord>().serialized_size() == 0);
+}
+
+TEST_CASE("zero-copy view over mapped bytes", "[serialize]")
+{
+  registry::register_type<point>();
+  registry::register_type<label>();
+
+  alignas(point) std::byte mapped[sizeof(point)];
+  point const src{10, 20};
+  std::memcpy(mapped, &src, sizeof(point));
+
+  auto view = registry::view(registry::id_of<point>(), mapped);
+  REQUIRE(!any::empty(*view));
+  REQUIRE(view->sum() == 30);
+
+  // the view reads the mapped bytes in place: mutating them is observable
+  point const updated{10, 21};
+  std::memcpy(mapped, &updated, sizeof(point));
+  REQUIRE(view->sum() == 31);
+
+  // non-trivially-copyable types cannot be viewed in place
+  REQUIRE(any::empty(*registry::view(registry::id_of<label>(), mapped)));
+
+  // nor can unregistered ids
+  REQUIRE(any::empty(*registry::view(~size_t(0), mapped)));
+}
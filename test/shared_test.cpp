@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/shared.hpp"
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+int live_documents = 0;
+
+template <class Base>
+struct idocument : any::interface<idocument, Base, any::extends<any::icopyable>>
+{
+  using idocument::interface::interface;
+
+  constexpr virtual int words() const
+  {
+    return any::value(*this).words();
+  }
+
+  constexpr virtual void set_words(int words)
+  {
+    any::value(*this).set_words(words);
+  }
+};
+
+struct document
+{
+  document(int words)
+    : words_(words)
+  {
+    ++live_documents;
+  }
+
+  document(document const &other)
+    : words_(other.words_)
+  {
+    ++live_documents;
+  }
+
+  document(document &&other) noexcept
+    : words_(other.words_)
+  {
+    ++live_documents;
+  }
+
+  ~document()
+  {
+    --live_documents;
+  }
+
+  int words() const
+  {
+    return words_;
+  }
+
+  void set_words(int words)
+  {
+    words_ = words;
+  }
+
+  int words_;
+};
+} // namespace
+
+TEST_CASE("shared_any copies are O(1)", "[shared_any]")
+{
+  {
+    any::shared_any<idocument> doc = document(100);
+    REQUIRE(doc.use_count() == 1);
+    REQUIRE((*doc).words() == 100);
+    REQUIRE(live_documents == 1);
+
+    // copies share the control block; no new document is created
+    auto fanout = doc;
+    auto third  = doc;
+    REQUIRE(doc.use_count() == 3);
+    REQUIRE(live_documents == 1);
+    REQUIRE(fanout->words() == 100);
+
+    // clone() pays for the one deep copy that is actually needed
+    any::any<idocument> deep = doc.clone();
+    REQUIRE(live_documents == 2);
+    REQUIRE(doc.use_count() == 3);
+
+    // mutate() detaches from the shared state before writing
+    third.mutate().set_words(7);
+    REQUIRE(third.use_count() == 1);
+    REQUIRE(doc.use_count() == 2);
+    REQUIRE(third->words() == 7);
+    REQUIRE(doc->words() == 100);
+
+    // mutating an unshared value does not copy
+    int const live_before = live_documents;
+    third.mutate().set_words(8);
+    REQUIRE(live_documents == live_before);
+
+    // move-conversion from any<Interface> is preserved
+    any::shared_any<idocument> moved = std::move(deep);
+    REQUIRE(moved->words() == 100);
+  }
+  REQUIRE(live_documents == 0);
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/span.hpp"
+
+#include <vector>
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct inum : any::interface<inum, Base>
+{
+  using inum::interface::interface;
+
+  constexpr virtual int get() const
+  {
+    return any::value(*this).get();
+  }
+
+  constexpr virtual void bump()
+  {
+    any::value(*this).bump();
+  }
+};
+
+struct counter
+{
+  int get() const
+  {
+    return n;
+  }
+
+  void bump()
+  {
+    ++n;
+  }
+
+  int n = 0;
+};
+} // namespace
+
+TEST_CASE("any_span views contiguous storage", "[span]")
+{
+  std::vector<counter> counters(4);
+  any::any_span<inum> view(counters);
+  REQUIRE(view.size() == 4);
+  REQUIRE(!view.empty());
+
+  // iteration mutates the elements in place
+  for (auto &element : view)
+    element.bump();
+  REQUIRE(counters[2].n == 1);
+
+  int total = 0;
+  view.for_each([&](any::iabstract<inum> &num) {
+    num.bump();
+    total += num.get();
+  });
+  REQUIRE(total == 8);
+  REQUIRE(counters[0].n == 2);
+
+  // a mutable span converts to a const view of the same elements
+  any::any_const_span<inum> cview = view;
+  total                           = 0;
+  cview.for_each([&](any::iabstract<inum> const &num) {
+    total += num.get();
+  });
+  REQUIRE(total == 8);
+
+  // a const container yields const views directly
+  std::vector<counter> const &ccounters = counters;
+  any::any_const_span<inum> cview2(ccounters);
+  REQUIRE(cview2.size() == 4);
+  REQUIRE((*cview2.begin()).get() == 2);
+
+  // a default-constructed span is an empty range
+  any::any_span<inum> none;
+  REQUIRE(none.empty());
+  REQUIRE(none.begin() == none.end());
+}
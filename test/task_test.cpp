@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/task.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+any::any_task append(std::vector<int> &log, int id)
+{
+  log.push_back(id);
+  co_return;
+}
+
+any::any_task chain(std::vector<int> &log)
+{
+  log.push_back(1);
+  co_await append(log, 2);
+  log.push_back(3);
+}
+
+any::any_task stepper(int &steps)
+{
+  ++steps;
+  co_await std::suspend_always{};
+  ++steps;
+}
+
+any::any_task failing()
+{
+  throw std::runtime_error("boom");
+  co_return; // unreachable; makes this function a coroutine
+}
+
+any::any_task awaits_failing(bool &caught)
+{
+  try
+  {
+    co_await failing();
+  }
+  catch (std::runtime_error const &)
+  {
+    caught = true;
+  }
+}
+} // namespace
+
+TEST_CASE("any_task erases into any<itask> without spilling", "[task]")
+{
+  std::vector<int> log;
+  any::any<any::itask> slot{chain(log)};
+
+  // the handle is one pointer; the only heap block anywhere is the frame
+  REQUIRE(slot._in_situ_());
+
+  // lazy: nothing ran at construction or erasure
+  REQUIRE(log.empty());
+  REQUIRE(!slot.done());
+
+  // one top-level resume drives the whole await chain by symmetric transfer
+  slot.resume();
+  REQUIRE(slot.done());
+  REQUIRE(log == std::vector<int>{1, 2, 3});
+}
+
+TEST_CASE("a suspended task resumes where it left off", "[task]")
+{
+  int steps = 0;
+  any::any<any::itask> slot{stepper(steps)};
+
+  slot.resume();
+  REQUIRE(steps == 1);
+  REQUIRE(!slot.done());
+
+  slot.resume();
+  REQUIRE(steps == 2);
+  REQUIRE(slot.done());
+}
+
+TEST_CASE("exceptions surface at the await or the top-level resume", "[task]")
+{
+  // awaited: rethrown into the awaiting coroutine
+  bool caught = false;
+  any::any_task task = awaits_failing(caught);
+  task.resume();
+  REQUIRE(caught);
+  REQUIRE(task.done());
+
+  // top-level: rethrown out of resume() when the task completes
+  any::any<any::itask> slot{failing()};
+  REQUIRE_THROWS_AS(slot.resume(), std::runtime_error);
+  REQUIRE(slot.done());
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/vector.hpp"
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct iarea : any::interface<iarea, Base>
+{
+  using iarea::interface::interface;
+
+  constexpr virtual int area() const
+  {
+    return any::value(*this).area();
+  }
+};
+
+struct square
+{
+  int area() const
+  {
+    return side * side;
+  }
+
+  int side;
+};
+
+struct circle
+{
+  int area() const
+  {
+    return 3 * radius * radius;
+  }
+
+  int radius;
+};
+} // namespace
+
+TEST_CASE("any_vector segments by concrete type", "[any_vector]")
+{
+  any::any_vector<iarea> shapes;
+  REQUIRE(shapes.empty());
+
+  shapes.reserve<square>(4);
+  shapes.push_back(square{2});
+  shapes.push_back(circle{1});
+  shapes.emplace_back<square>(3);
+  shapes.emplace_back<circle>(2);
+
+  REQUIRE(shapes.size() == 4);
+  REQUIRE(shapes.segment_count() == 2);
+
+  // type-erased traversal visits every element, segment by segment
+  int total = 0;
+  shapes.for_each([&](any::iabstract<iarea> &shape) { total += shape.area(); });
+  REQUIRE(total == 4 + 9 + 3 + 12);
+
+  // traversal with the concrete types restored computes the same answer
+  total = 0;
+  shapes.for_each<square, circle>([&](auto &shape) { total += shape.area(); });
+  REQUIRE(total == 4 + 9 + 3 + 12);
+
+  // unnamed types fall back to the type-erased traversal
+  total = 0;
+  shapes.for_each<square>([&](auto &shape) { total += shape.area(); });
+  REQUIRE(total == 4 + 9 + 3 + 12);
+
+  // const traversal
+  auto const &cshapes = shapes;
+  total               = 0;
+  cshapes.for_each([&](any::iabstract<iarea> const &shape) { total += shape.area(); });
+  REQUIRE(total == 4 + 9 + 3 + 12);
+
+  shapes.clear();
+  REQUIRE(shapes.empty());
+  REQUIRE(shapes.size() == 0);
+}
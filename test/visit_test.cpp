@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 NVIDIA Corporation
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "any/visit.hpp"
+
+#include "catch2/catch_all.hpp" // IWYU pragma: keep
+
+namespace
+{
+template <class Base>
+struct imessage : any::interface<imessage, Base, any::extends<any::icopyable>>
+{
+  using imessage::interface::interface;
+
+  constexpr virtual int id() const
+  {
+    return any::value(*this).id();
+  }
+};
+
+struct ping
+{
+  constexpr int id() const
+  {
+    return 1;
+  }
+
+  int seq = 0;
+};
+
+struct pong
+{
+  constexpr int id() const
+  {
+    return 2;
+  }
+
+  int seq = 0;
+};
+
+struct data
+{
+  constexpr int id() const
+  {
+    return 3;
+  }
+
+  int payload = 0;
+};
+} // namespace
+
+TEST_CASE("visit dispatches over a closed set of types", "[visit]")
+{
+  any::any<imessage> msg = ping{.seq = 7};
+
+  // the visitor sees the concrete type, not the interface
+  int seq = any::visit<ping, pong>(msg, [](auto const &m) {
+    return m.seq;
+  });
+  REQUIRE(seq == 7);
+
+  // mutation through a non-const visit
+  any::visit<ping, pong>(msg, [](auto &m) {
+    ++m.seq;
+  });
+  REQUIRE(any::any_cast<ping>(msg).seq == 8);
+
+  // alternatives dispatch by stored type, in list order or not
+  msg = pong{.seq = 3};
+  REQUIRE(any::visit<data, pong, ping>(msg, [](auto const &m) {
+            return m.id();
+          })
+          == 2);
+
+  // a const any visits with a const reference
+  any::any<imessage> const cmsg = data{.payload = 99};
+  REQUIRE(any::visit<data>(cmsg, [](data const &d) {
+            return d.payload;
+          })
+          == 99);
+
+  // a stored type outside the listed set throws
+  REQUIRE_THROWS_AS(any::visit<ping, pong>(cmsg,
+                                           [](auto const &m) {
+                                             return m.id();
+                                           }),
+                    any::bad_any_cast);
+
+  // an empty any never matches
+  any::any<imessage> none;
+  REQUIRE_THROWS_AS(any::visit<ping>(none,
+                                     [](auto const &m) {
+                                       return m.id();
+                                     }),
+                    any::bad_any_cast);
+}